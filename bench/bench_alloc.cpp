@@ -0,0 +1,101 @@
+#include "arbys/bignum/big_int.h"
+
+#include "helpers/alloc_counter.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+namespace arbys::bignum::bench {
+
+// Heap traffic and latency of everyday operations on values that fit in a few limbs.
+// Each benchmark reports `allocs_per_op` next to the timing.
+
+static void BM_DefaultConstruct(benchmark::State &state) {
+    const helpers::alloc_scope allocs(state);
+    for (auto _ : state) {
+        big_int x;
+        benchmark::DoNotOptimize(x);
+    }
+}
+BENCHMARK(BM_DefaultConstruct);
+
+static void BM_FromInteger(benchmark::State &state) {
+    const helpers::alloc_scope allocs(state);
+    long long                  value = 1'234'567'890'123LL;
+    for (auto _ : state) {
+        big_int x = big_int::from_integer(value);
+        benchmark::DoNotOptimize(x);
+        ++value;
+    }
+}
+BENCHMARK(BM_FromInteger);
+
+static void BM_CopySmall(benchmark::State &state) {
+    const big_int              src = big_int::from_integer(987'654'321'987LL);
+    const helpers::alloc_scope allocs(state);
+    for (auto _ : state) {
+        big_int x = src;
+        benchmark::DoNotOptimize(x);
+    }
+}
+BENCHMARK(BM_CopySmall);
+
+static void BM_AddSmall(benchmark::State &state) {
+    const big_int              a = big_int::from_string("123456789012345678901234567").value();
+    const big_int              b = big_int::from_string("987654321098765432109876543").value();
+    const helpers::alloc_scope allocs(state);
+    for (auto _ : state) {
+        big_int x = a + b;
+        benchmark::DoNotOptimize(x);
+    }
+}
+BENCHMARK(BM_AddSmall);
+
+static void BM_SubSmall(benchmark::State &state) {
+    const big_int              a = big_int::from_string("987654321098765432109876543").value();
+    const big_int              b = big_int::from_string("123456789012345678901234567").value();
+    const helpers::alloc_scope allocs(state);
+    for (auto _ : state) {
+        big_int x = a - b;
+        benchmark::DoNotOptimize(x);
+    }
+}
+BENCHMARK(BM_SubSmall);
+
+static void BM_MulSmall(benchmark::State &state) {
+    const big_int              a = big_int::from_string("1234567890123456789").value();
+    const big_int              b = big_int::from_string("9876543210987654321").value();
+    const helpers::alloc_scope allocs(state);
+    for (auto _ : state) {
+        big_int x = a * b;
+        benchmark::DoNotOptimize(x);
+    }
+}
+BENCHMARK(BM_MulSmall);
+
+static void BM_DivModSmall(benchmark::State &state) {
+    const big_int              a = big_int::from_string("123456789012345678901234567").value();
+    const big_int              b = big_int::from_string("98765432109").value();
+    const helpers::alloc_scope allocs(state);
+    for (auto _ : state) {
+        auto x = a.div_mod(b);
+        benchmark::DoNotOptimize(x);
+    }
+}
+BENCHMARK(BM_DivModSmall);
+
+static void BM_Accumulate(benchmark::State &state) {
+    const big_int              step = big_int::from_integer(1'000'000'007LL);
+    const helpers::alloc_scope allocs(state);
+    for (auto _ : state) {
+        big_int total;
+        for (int i = 0; i < 64; ++i) {
+            total = total + step;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+}
+BENCHMARK(BM_Accumulate);
+
+} // namespace arbys::bignum::bench
@@ -0,0 +1,419 @@
+#include "arbys/bignum/big_int.h"
+
+#include "helpers/operands.h"
+
+#include <benchmark/benchmark.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace arbys::bignum::bench {
+
+// Every operation across size classes, from a single limb up to 10^6 limbs. Arguments are limb
+// counts; two-argument benchmarks take the longer operand first. Run with
+//   --benchmark_out=run.json --benchmark_out_format=json
+// and compare two runs with bench/compare.py.
+
+// Division is recursive past a few dozen limbs but still several multiplications deep; past this a
+// single iteration takes tens of seconds
+constexpr std::int64_t division_max_limbs = 100'000;
+
+static void all_sizes(benchmark::internal::Benchmark *b) {
+    b->RangeMultiplier(10)->Range(1, 1'000'000)->Unit(benchmark::kMicrosecond);
+}
+
+static void division_sizes(benchmark::internal::Benchmark *b) {
+    b->RangeMultiplier(10)->Range(1, division_max_limbs)->Unit(benchmark::kMicrosecond);
+}
+
+// (longer, shorter) shapes, from balanced to very lopsided
+static void unbalanced_shapes(benchmark::internal::Benchmark *b) {
+    for (const std::int64_t shorter : {1, 10, 100, 1'000, 10'000}) {
+        for (const std::int64_t ratio : {2, 10, 100}) {
+            if (shorter * ratio <= 1'000'000) {
+                b->Args({shorter * ratio, shorter});
+            }
+        }
+    }
+    b->Unit(benchmark::kMicrosecond);
+}
+
+static void set_limbs_processed(benchmark::State &state, const std::int64_t limbs) {
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * limbs);
+}
+
+static void BM_Add(benchmark::State &state) {
+    const big_int a = helpers::random_operand(state.range(0), 1);
+    const big_int b = helpers::random_operand(state.range(0), 2);
+    for (auto _ : state) {
+        big_int x = a + b;
+        benchmark::DoNotOptimize(x);
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_Add)->Apply(all_sizes);
+
+static void BM_AddUnbalanced(benchmark::State &state) {
+    const big_int a = helpers::random_operand(state.range(0), 3);
+    const big_int b = helpers::random_operand(state.range(1), 4);
+    for (auto _ : state) {
+        big_int x = a + b;
+        benchmark::DoNotOptimize(x);
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_AddUnbalanced)->Apply(unbalanced_shapes);
+
+static void BM_AddAssign(benchmark::State &state) {
+    big_int       a = helpers::random_operand(state.range(0), 5);
+    const big_int b = helpers::random_operand(state.range(0), 6);
+    for (auto _ : state) {
+        a += b;
+        benchmark::DoNotOptimize(a);
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_AddAssign)->Apply(all_sizes);
+
+static void BM_Sub(benchmark::State &state) {
+    const big_int a = helpers::random_operand(state.range(0), 7);
+    const big_int b = helpers::random_operand(state.range(0), 8);
+    for (auto _ : state) {
+        big_int x = a - b;
+        benchmark::DoNotOptimize(x);
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_Sub)->Apply(all_sizes);
+
+static void BM_SubUnbalanced(benchmark::State &state) {
+    const big_int a = helpers::random_operand(state.range(0), 9);
+    const big_int b = helpers::random_operand(state.range(1), 10);
+    for (auto _ : state) {
+        big_int x = a - b;
+        benchmark::DoNotOptimize(x);
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_SubUnbalanced)->Apply(unbalanced_shapes);
+
+static void BM_Mul(benchmark::State &state) {
+    const big_int a = helpers::random_operand(state.range(0), 11);
+    const big_int b = helpers::random_operand(state.range(0), 12);
+    for (auto _ : state) {
+        big_int x = a * b;
+        benchmark::DoNotOptimize(x);
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_Mul)->Apply(all_sizes);
+
+static void BM_MulUnbalanced(benchmark::State &state) {
+    const big_int a = helpers::random_operand(state.range(0), 13);
+    const big_int b = helpers::random_operand(state.range(1), 14);
+    for (auto _ : state) {
+        big_int x = a * b;
+        benchmark::DoNotOptimize(x);
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_MulUnbalanced)->Apply(unbalanced_shapes);
+
+static void BM_Square(benchmark::State &state) {
+    const big_int a = helpers::random_operand(state.range(0), 15);
+    for (auto _ : state) {
+        big_int x = a.square();
+        benchmark::DoNotOptimize(x);
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_Square)->Apply(all_sizes);
+
+// dividend of twice the divisor's length: the quotient is as long as the divisor
+static void BM_DivMod(benchmark::State &state) {
+    const big_int a = helpers::random_operand(2 * state.range(0), 16);
+    const big_int b = helpers::random_operand(state.range(0), 17);
+    for (auto _ : state) {
+        auto x = a.div_mod(b);
+        benchmark::DoNotOptimize(x);
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_DivMod)->Apply(division_sizes);
+
+// as BM_DivMod, keeping only the remainder
+static void BM_Mod(benchmark::State &state) {
+    const big_int a = helpers::random_operand(2 * state.range(0), 16);
+    const big_int b = helpers::random_operand(state.range(0), 17);
+    for (auto _ : state) {
+        auto x = a % b;
+        benchmark::DoNotOptimize(x);
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_Mod)->Apply(division_sizes);
+
+// a long dividend reduced by one limb, as bucketing a hash does
+static void BM_ModLimb(benchmark::State &state) {
+    const big_int a = helpers::random_operand(state.range(0), 16);
+    for (auto _ : state) {
+        auto x = a % 1000003u;
+        benchmark::DoNotOptimize(x);
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_ModLimb)->Apply(all_sizes);
+
+// as BM_DivMod on a dividend the divisor is known to divide
+static void BM_DivExact(benchmark::State &state) {
+    const big_int b = helpers::random_operand(state.range(0), 17);
+    const big_int a = helpers::random_operand(state.range(0), 16) * b;
+    for (auto _ : state) {
+        auto x = a.divexact(b);
+        benchmark::DoNotOptimize(x);
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_DivExact)->Apply(division_sizes);
+
+// as BM_DivMod with the divisor prepared once, outside the loop
+static void BM_DivisorDivMod(benchmark::State &state) {
+    const big_int          a = helpers::random_operand(2 * state.range(0), 16);
+    const big_int::divisor b(helpers::random_operand(state.range(0), 17));
+    for (auto _ : state) {
+        auto x = b.div_mod(a);
+        benchmark::DoNotOptimize(x);
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_DivisorDivMod)->Apply(division_sizes);
+
+// as BM_DivMod through a reducer built once, outside the loop
+static void BM_BarrettReduce(benchmark::State &state) {
+    const big_int         a = helpers::random_operand(2 * state.range(0), 16);
+    const barrett_reducer m(helpers::random_operand(state.range(0), 17));
+    for (auto _ : state) {
+        auto x = m.div_mod(a);
+        benchmark::DoNotOptimize(x);
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_BarrettReduce)->Apply(division_sizes);
+
+static void BM_Reciprocal(benchmark::State &state) {
+    const big_int a = helpers::random_operand(state.range(0), 17);
+    for (auto _ : state) {
+        // as many fraction bits as reciprocal_abs gives for the size, twice the bits of a
+        auto x = a.reciprocal(2 * std::numeric_limits<limb_type>::digits * static_cast<std::size_t>(state.range(0)));
+        benchmark::DoNotOptimize(x);
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_Reciprocal)->Apply(division_sizes);
+
+static void BM_DivModUnbalanced(benchmark::State &state) {
+    const big_int a = helpers::random_operand(state.range(0), 18);
+    const big_int b = helpers::random_operand(state.range(1), 19);
+    for (auto _ : state) {
+        auto x = a.div_mod(b);
+        benchmark::DoNotOptimize(x);
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_DivModUnbalanced)
+  ->Args({10'000, 1})
+  ->Args({10'000, 10})
+  ->Args({10'000, 100})
+  ->Args({10'000, 1'000})
+  ->Args({100'000, 1})
+  ->Args({100'000, 10})
+  ->Unit(benchmark::kMicrosecond);
+
+// equal except for the lowest limb, so the comparison has to scan every limb
+static void BM_Cmp(benchmark::State &state) {
+    const big_int a = helpers::random_operand(state.range(0), 20);
+    const big_int b = a + big_int(1);
+    for (auto _ : state) {
+        auto x = a <=> b;
+        benchmark::DoNotOptimize(x);
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_Cmp)->Apply(all_sizes);
+
+static void BM_FromString(benchmark::State &state) {
+    const std::string s = helpers::random_decimal(state.range(0), 21);
+    for (auto _ : state) {
+        auto x = big_int::from_string(s);
+        benchmark::DoNotOptimize(x);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * s.size()));
+}
+BENCHMARK(BM_FromString)->Apply(all_sizes);
+
+// (limbs, threads); the digits are written to a temporary file once and parsed from it every iteration
+static void BM_FromFile(benchmark::State &state) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "arbys_bignum_bench_from_file.txt";
+    const std::string           s    = helpers::random_decimal(state.range(0), 21);
+    std::ofstream(path, std::ios::binary) << s;
+    for (auto _ : state) {
+        auto x = big_int::from_file(path, {}, static_cast<unsigned>(state.range(1)));
+        benchmark::DoNotOptimize(x);
+    }
+    std::filesystem::remove(path);
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * s.size()));
+}
+BENCHMARK(BM_FromFile)
+  ->ArgsProduct({{10'000, 100'000, 1'000'000}, {1, 2, 4, 8}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
+
+static void BM_ToString(benchmark::State &state) {
+    const big_int a = helpers::random_operand(state.range(0), 22);
+    std::size_t   digits = 0;
+    for (auto _ : state) {
+        std::string s = a.to_string();
+        digits        = s.size();
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * digits));
+}
+BENCHMARK(BM_ToString)->Apply(all_sizes);
+
+// into a buffer sized once up front, as a logging or serialization path would
+static void BM_ToChars(benchmark::State &state) {
+    const big_int     a = helpers::random_operand(state.range(0), 27);
+    std::vector<char> buffer(a.max_chars());
+    std::size_t       digits = 0;
+    for (auto _ : state) {
+        const auto result = a.to_chars(buffer.data(), buffer.data() + buffer.size());
+        digits            = static_cast<std::size_t>(result.ptr - buffer.data());
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * digits));
+}
+BENCHMARK(BM_ToChars)->Apply(all_sizes);
+
+static void BM_FromChars(benchmark::State &state) {
+    const std::string s = helpers::random_decimal(state.range(0), 28);
+    big_int           x;
+    for (auto _ : state) {
+        auto result = big_int::from_chars(s.data(), s.data() + s.size(), x);
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(x);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * s.size()));
+}
+BENCHMARK(BM_FromChars)->Apply(all_sizes);
+
+static void BM_FromStringHex(benchmark::State &state) {
+    const std::string s = helpers::random_operand(state.range(0), 23).to_string(16);
+    for (auto _ : state) {
+        auto x = big_int::from_string(s, 16);
+        benchmark::DoNotOptimize(x);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * s.size()));
+}
+BENCHMARK(BM_FromStringHex)->Apply(all_sizes);
+
+static void BM_ToStringHex(benchmark::State &state) {
+    const big_int a = helpers::random_operand(state.range(0), 24);
+    std::size_t   digits = 0;
+    for (auto _ : state) {
+        std::string s = a.to_string(16);
+        digits        = s.size();
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * digits));
+}
+BENCHMARK(BM_ToStringHex)->Apply(all_sizes);
+
+// a base that is neither a power of two nor ten takes the general divide-and-conquer paths
+static void BM_FromStringBase36(benchmark::State &state) {
+    const std::string s = helpers::random_operand(state.range(0), 25).to_string(36);
+    for (auto _ : state) {
+        auto x = big_int::from_string(s, 36);
+        benchmark::DoNotOptimize(x);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * s.size()));
+}
+BENCHMARK(BM_FromStringBase36)->Apply(all_sizes);
+
+static void BM_ToStringBase36(benchmark::State &state) {
+    const big_int a = helpers::random_operand(state.range(0), 26);
+    std::size_t   digits = 0;
+    for (auto _ : state) {
+        std::string s = a.to_string(36);
+        digits        = s.size();
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * digits));
+}
+BENCHMARK(BM_ToStringBase36)->Apply(all_sizes);
+
+static void BM_ToBytes(benchmark::State &state) {
+    const big_int          a = -helpers::random_operand(state.range(0), 29);
+    std::vector<std::byte> buffer(a.byte_size());
+    for (auto _ : state) {
+        auto result = a.to_bytes(std::span(buffer), std::endian::little);
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+}
+BENCHMARK(BM_ToBytes)->Apply(all_sizes);
+
+static void BM_FromBytes(benchmark::State &state) {
+    const std::vector<std::byte> bytes = helpers::random_operand(state.range(0), 30).to_bytes();
+    for (auto _ : state) {
+        auto x = big_int::from_bytes(bytes);
+        benchmark::DoNotOptimize(x);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes.size()));
+}
+BENCHMARK(BM_FromBytes)->Apply(all_sizes);
+
+// Views over limbs held outside any big_int, as a row of a memory-mapped table would be
+static void BM_ViewAdd(benchmark::State &state) {
+    const big_int                a = helpers::random_operand(state.range(0), 31);
+    const big_int                b = helpers::random_operand(state.range(0), 32);
+    const std::vector<limb_type> limbs(big_int_view(a).limbs().begin(), big_int_view(a).limbs().end());
+    const big_int_view           view(false, limbs);
+    for (auto _ : state) {
+        big_int x = view + b;
+        benchmark::DoNotOptimize(x);
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_ViewAdd)->Apply(all_sizes);
+
+static void BM_Hash(benchmark::State &state) {
+    const big_int a = helpers::random_operand(state.range(0), 33);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::hash<big_int>{}(a));
+    }
+    set_limbs_processed(state, state.range(0));
+}
+BENCHMARK(BM_Hash)->Apply(all_sizes);
+
+template <class T> static void BM_FromInteger(benchmark::State &state) {
+    T value = std::numeric_limits<T>::max() / 3;
+    for (auto _ : state) {
+        big_int x = big_int::from_integer(value);
+        benchmark::DoNotOptimize(x);
+        value = static_cast<T>(value - 1);
+    }
+}
+BENCHMARK(BM_FromInteger<int>);
+BENCHMARK(BM_FromInteger<long long>);
+BENCHMARK(BM_FromInteger<unsigned long long>);
+
+} // namespace arbys::bignum::bench
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""Compare two arbys-bignum-bench JSON runs and flag regressions.
+
+Produce the runs with
+    arbys-bignum-bench --benchmark_out=base.json --benchmark_out_format=json
+then
+    bench/compare.py base.json new.json [--threshold 5] [--filter BM_Mul]
+
+When the runs were made with --benchmark_repetitions, the median aggregates are compared.
+The exit status is 1 if any benchmark slowed down by more than the threshold (in percent).
+"""
+
+import argparse
+import json
+import re
+import sys
+
+TO_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(path):
+    with open(path, encoding="utf-8") as f:
+        benchmarks = json.load(f)["benchmarks"]
+
+    medians = {b["run_name"]: b for b in benchmarks if b.get("aggregate_name") == "median"}
+    if medians:
+        return medians
+
+    return {b["name"]: b for b in benchmarks if b.get("run_type", "iteration") == "iteration"}
+
+
+def time_ns(entry, field):
+    return entry[field] * TO_NS[entry.get("time_unit", "ns")]
+
+
+def format_ns(ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= scale:
+            return f"{ns / scale:.3g} {unit}"
+    return f"{ns:.3g} ns"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("base", help="JSON output of the reference run")
+    parser.add_argument("new", help="JSON output of the run to check")
+    parser.add_argument("--threshold", type=float, default=5.0, help="regression threshold in percent (default 5)")
+    parser.add_argument("--field", choices=("real_time", "cpu_time"), default="cpu_time")
+    parser.add_argument("--filter", default="", help="only compare benchmarks whose name matches this regex")
+    args = parser.parse_args()
+
+    base = load(args.base)
+    new = load(args.new)
+    pattern = re.compile(args.filter)
+
+    names = [name for name in base if name in new and pattern.search(name)]
+    if not names:
+        print("no benchmarks in common", file=sys.stderr)
+        return 2
+
+    width = max(len(name) for name in names)
+    print(f"{'benchmark':<{width}}  {'base':>10}  {'new':>10}  {'change':>8}")
+
+    regressions = []
+    for name in names:
+        before = time_ns(base[name], args.field)
+        after = time_ns(new[name], args.field)
+        change = (after - before) / before * 100.0 if before > 0 else 0.0
+
+        marker = ""
+        if change > args.threshold:
+            marker = "  REGRESSION"
+            regressions.append(name)
+        elif change < -args.threshold:
+            marker = "  improved"
+
+        print(f"{name:<{width}}  {format_ns(before):>10}  {format_ns(after):>10}  {change:+7.1f}%{marker}")
+
+    only_base = sum(1 for name in base if name not in new and pattern.search(name))
+    only_new = sum(1 for name in new if name not in base and pattern.search(name))
+    if only_base or only_new:
+        print(f"\n{only_base} benchmark(s) only in base, {only_new} only in new")
+
+    if regressions:
+        print(f"\n{len(regressions)} regression(s) above {args.threshold:g}%")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,30 @@
+#include "alloc_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+std::atomic<std::size_t> allocations{0};
+
+void *counted_alloc(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+} // namespace
+
+void *operator new(std::size_t size) { return counted_alloc(size); }
+void *operator new[](std::size_t size) { return counted_alloc(size); }
+void  operator delete(void *p) noexcept { std::free(p); }
+void  operator delete[](void *p) noexcept { std::free(p); }
+void  operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void  operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+namespace arbys::bignum::bench::helpers {
+
+std::size_t allocation_count() noexcept { return allocations.load(std::memory_order_relaxed); }
+
+} // namespace arbys::bignum::bench::helpers
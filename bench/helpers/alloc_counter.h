@@ -0,0 +1,31 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+namespace arbys::bignum::bench::helpers {
+
+/// Number of calls to global operator new since program start
+[[nodiscard]] std::size_t allocation_count() noexcept;
+
+/// Counts heap allocations made while a benchmark runs and reports them per iteration
+class alloc_scope {
+  public:
+    explicit alloc_scope(benchmark::State &state) noexcept : state_(state), start_(allocation_count()) {}
+
+    alloc_scope(const alloc_scope &)            = delete;
+    alloc_scope &operator=(const alloc_scope &) = delete;
+
+    ~alloc_scope() {
+        const auto allocs = static_cast<double>(allocation_count() - start_);
+        state_.counters["allocs_per_op"] =
+          benchmark::Counter(allocs, benchmark::Counter::kAvgIterations);
+    }
+
+  private:
+    benchmark::State &state_;
+    std::size_t       start_;
+};
+
+} // namespace arbys::bignum::bench::helpers
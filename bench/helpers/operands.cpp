@@ -0,0 +1,39 @@
+#include "operands.h"
+
+#include "../../src/arbys/bignum/detail/big_int_internal.h"
+
+#include <cmath>
+#include <random>
+#include <utility>
+
+namespace arbys::bignum::bench::helpers {
+
+big_int random_operand(const std::size_t limbs, const std::uint64_t seed) {
+    std::mt19937_64     rng(seed);
+    detail::limb_vector digits(limbs);
+    for (auto &limb : digits) {
+        limb = static_cast<detail::limb_t>(rng());
+    }
+    if (limbs > 0 && digits.back() == 0) {
+        digits.back() = 1;
+    }
+    return detail::big_int_access::create(false, std::move(digits));
+}
+
+std::string random_decimal(const std::size_t limbs, const std::uint64_t seed) {
+    const auto digits = static_cast<std::size_t>(std::ceil(static_cast<double>(limbs * detail::LIMB_BITS) * std::log10(2.0)));
+
+    std::mt19937_64                    rng(seed);
+    std::uniform_int_distribution<int> digit(0, 9);
+
+    std::string s(digits, '0');
+    for (char &c : s) {
+        c = static_cast<char>('0' + digit(rng));
+    }
+    if (s.front() == '0') {
+        s.front() = '1';
+    }
+    return s;
+}
+
+} // namespace arbys::bignum::bench::helpers
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "arbys/bignum/big_int.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace arbys::bignum::bench::helpers {
+
+/// Random non-negative big_int with exactly `limbs` limbs (the top limb is non-zero).
+/// Built straight from limbs, so even million-limb operands are cheap to set up
+[[nodiscard]] big_int random_operand(std::size_t limbs, std::uint64_t seed);
+
+/// Random decimal string (no leading zero) with as many digits as a `limbs`-limb number has
+[[nodiscard]] std::string random_decimal(std::size_t limbs, std::uint64_t seed);
+
+} // namespace arbys::bignum::bench::helpers
@@ -1,14 +1,23 @@
 #pragma once
 
+#include <algorithm>
+#include <bit>
+#include <charconv>
 #include <compare>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
 #include <expected>
-#include <memory>
+#include <filesystem>
+#include <span>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
+#include "big_int_view.h"
 #include "errors.h"
 
 namespace arbys::bignum {
@@ -16,8 +25,18 @@ namespace arbys::bignum {
 namespace detail {
 struct big_int_impl;
 struct big_int_access;
+
+/// Native integers accepted by the scalar fast paths: any integral type up to 64 bits except bool
+template <class T>
+concept small_integer = std::integral<T> && !std::same_as<T, bool> && sizeof(T) <= sizeof(std::uint64_t);
 } // namespace detail
 
+/// How to_bytes and from_bytes represent the sign
+enum class byte_encoding {
+    twos_complement, ///< two's complement, sign-extended to the width; the top bit is the sign
+    sign_magnitude,  ///< the magnitude, zero-padded, with the sign in the top bit of the most significant byte
+};
+
 /**
  * @brief Type for representing arbytrary prcision numbers
  */
@@ -40,6 +59,12 @@ class big_int {
      */
     big_int(const big_int &other);
 
+    /**
+     * @brief Copies the number a view refers to
+     * @param value the view whose limbs to copy
+     */
+    explicit big_int(big_int_view value);
+
     /**
      * @brief Move constructor
      * @param other the big_int to move
@@ -96,6 +121,28 @@ class big_int {
       std::string_view input,
       std::string_view separator
     );
+    /**
+     * @brief Factory method for constructing a big_int out of digits in any base from 2 to 36
+     * @param input optional sign, then digits and letters in either case, without a prefix such as 0x
+     * @param base power-of-two bases are parsed in linear time, the others by divide and conquer
+     * @return the value, or ParseError::InvalidBase for a base outside [2, 36]
+     */
+    [[nodiscard]] static std::expected<big_int, errors::ParseError> from_string(std::string_view input, int base);
+    /**
+     * @brief Factory method for constructing a big_int out of a file of decimal digits, such as a
+     * published constant with millions of digits
+     * @param path the file is memory-mapped where the platform allows it and read otherwise; it holds an
+     * optional sign and the digits, with surrounding whitespace ignored
+     * @param separator skipped between digits, as in from_string(input, separator)
+     * @param threads the blocks of digits are parsed and recombined on up to this many threads; 0 uses
+     * std::thread::hardware_concurrency
+     * @return the value, or ParseError::UnreadableFile if the file could not be opened or read
+     */
+    [[nodiscard]] static std::expected<big_int, errors::ParseError> from_file(
+      const std::filesystem::path &path,
+      std::string_view             separator = {},
+      unsigned                     threads   = 0
+    );
 
     /**
      * @brief Factory method for constructing a big_int out of a std::integral
@@ -105,6 +152,28 @@ class big_int {
      */
     template <std::integral T> [[nodiscard]] static big_int from_integer(T value);
 
+    /**
+     * @brief Factory method taking over a limb buffer, for exchanging numbers with other bignum code
+     * @param limbs the magnitude, least significant limb first; zero limbs at the top are dropped, and
+     * no limbs is zero. Buffers longer than the inline storage are adopted without a copy.
+     * @param negative the sign; ignored for zero
+     * @return the number
+     */
+    [[nodiscard]] static big_int from_limbs(std::vector<limb_type> &&limbs, bool negative = false);
+
+    /**
+     * @brief The magnitude, least significant limb first, without zero limbs at the top
+     * @return at least one limb; zero is a single zero limb. Valid until the number is next modified
+     */
+    [[nodiscard]] std::span<const limb_type> limbs() const noexcept;
+
+    /**
+     * @brief Moves the limbs out, leaving the number zero; from_limbs takes them back
+     * @return limbs() as a vector: the heap buffer itself for values past the inline storage, a copy
+     * for smaller ones
+     */
+    [[nodiscard]] std::vector<limb_type> release_limbs();
+
     /**
      * @brief Returns weather or not the numbr is negative
      * @return true if the number is negative, false if it is positive
@@ -123,7 +192,101 @@ class big_int {
      */
     [[nodiscard]] std::string to_string() const;
 
+    /**
+     * @brief Converts the number to a std::string in any base from 2 to 36, with lowercase letters
+     * @param base power-of-two bases are written in linear time, the others by divide and conquer
+     * @return std::string representing the number in the given base, without a prefix
+     * @throws std::invalid_argument if base is outside [2, 36]
+     */
+    [[nodiscard]] std::string to_string(int base) const;
+
+    /**
+     * @brief Upper bound on the characters to_chars writes, sign included
+     * @param base 2 to 36
+     * @return at least the length of to_string(base) and at most one more; 0 for a base outside [2, 36]
+     */
+    [[nodiscard]] std::size_t max_chars(int base = 10) const noexcept;
+
+    /**
+     * @brief Writes the number into [first, last) like std::to_chars: a '-' if negative, then lowercase
+     * digits, no prefix and no terminator
+     * @param base 2 to 36
+     * @return {one past the last character written, std::errc{}}, or {last, std::errc::value_too_large}
+     * if the buffer is too small (max_chars is always enough); {last, std::errc::invalid_argument} for
+     * a base outside [2, 36]. Allocates only for values of more than a few hundred digits.
+     */
+    std::to_chars_result to_chars(char *first, char *last, int base = 10) const;
+
+    /**
+     * @brief Parses [first, last) like std::from_chars: an optional '-', then the longest run of digits of
+     * the base, letters in either case; no leading whitespace, '+' or prefix
+     * @param value receives the result; left untouched on error
+     * @param base 2 to 36
+     * @return {one past the last digit, std::errc{}}, or {first, std::errc::invalid_argument} if there are
+     * no digits or the base is outside [2, 36]
+     */
+    static std::from_chars_result from_chars(const char *first, const char *last, big_int &value, int base = 10);
+
+    /**
+     * @brief Fewest bytes to_bytes needs for the number, sign bit included
+     * @param encoding how the sign is stored
+     * @return at least 1; zero takes one byte
+     */
+    [[nodiscard]] std::size_t byte_size(byte_encoding encoding = byte_encoding::twos_complement) const noexcept;
+
+    /**
+     * @brief Exports the number as byte_size(encoding) bytes
+     * @param order std::endian::big puts the most significant byte first, as in network byte order
+     * @param encoding how the sign is stored
+     * @return the bytes; from_bytes with the same order and encoding gives the number back
+     */
+    [[nodiscard]] std::vector<std::byte> to_bytes(
+      std::endian   order    = std::endian::big,
+      byte_encoding encoding = byte_encoding::twos_complement
+    ) const;
+
+    /**
+     * @brief Exports the number as exactly width bytes, padded with zeros (or ones, for negative two's
+     * complement) on the most significant side
+     * @return the bytes, or ArithmeticError::Overflow if the number needs more than width bytes
+     */
+    [[nodiscard]] std::expected<std::vector<std::byte>, errors::ArithmeticError> to_bytes(
+      std::size_t   width,
+      std::endian   order    = std::endian::big,
+      byte_encoding encoding = byte_encoding::twos_complement
+    ) const;
+
+    /**
+     * @brief Exports the number into all of out, padded as the fixed-width to_bytes; does not allocate
+     * @return nothing, or ArithmeticError::Overflow, leaving out untouched, if the number needs more than
+     * out.size() bytes
+     */
+    [[nodiscard]] std::expected<void, errors::ArithmeticError> to_bytes(
+      std::span<std::byte> out,
+      std::endian          order    = std::endian::big,
+      byte_encoding        encoding = byte_encoding::twos_complement
+    ) const;
+
+    /**
+     * @brief Imports a number exported by to_bytes, of any width
+     * @param bytes the encoded number; no bytes is zero
+     * @param order std::endian::big if the most significant byte comes first
+     * @param encoding how the sign is stored
+     * @return the number
+     */
+    [[nodiscard]] static big_int from_bytes(
+      std::span<const std::byte> bytes,
+      std::endian                order    = std::endian::big,
+      byte_encoding              encoding = byte_encoding::twos_complement
+    );
+
     template <class Out> Out format_to(Out out) const {
+        // through a stack buffer when it is enough, which covers values up to a few hundred digits
+        char buffer[format_buffer_size];
+        if (max_chars() <= format_buffer_size) {
+            const std::to_chars_result result = to_chars(buffer, buffer + format_buffer_size);
+            return std::copy(buffer, result.ptr, out);
+        }
         const std::string s = to_string();
         return std::copy(s.begin(), s.end(), out);
     }
@@ -138,6 +301,105 @@ class big_int {
       const big_int &other
     ) const noexcept;
 
+    /**
+     * @brief Quotient of a division known to be exact, such as by a gcd or a factor of a binomial coefficient
+     *
+     * Works from the low limbs up with the inverse of the divisor modulo the limb base, so it never estimates
+     * and corrects quotient limbs or builds a remainder. For divisors of two to a few hundred limbs that makes
+     * it about 1.2 to 1.6 times as fast as div; single-limb divisors and operands long enough for the recursive
+     * division run at div's speed. The result is unspecified when other does not divide *this; debug builds
+     * assert that it does.
+     * @param other a divisor of *this
+     * @return the quotient, or ArithmeticError::DivisionByZero for a zero divisor
+     */
+    [[nodiscard]] std::expected<big_int, errors::ArithmeticError> divexact(const big_int &other) const noexcept;
+
+    /**
+     * @brief Fixed-point reciprocal by Newton iteration: 2^precision / x, truncated towards zero
+     *
+     * Not a fast path: it takes about twice as long as dividing 2^precision by x with operator/. It is for
+     * callers that reuse the result, as barrett_reducer does with its own.
+     * @param precision fraction bits of the result; the iteration runs at about that many bits
+     * @return the reciprocal, or ArithmeticError::DivisionByZero for zero
+     */
+    [[nodiscard]] std::expected<big_int, errors::ArithmeticError> reciprocal(std::size_t precision) const noexcept;
+
+    // A divisor prepared once for dividing many numbers by it; defined below
+    class divisor;
+
+    /**
+     * @brief Squares the number, doing roughly half the limb products of a general multiplication
+     * @return the square of the number; mul() forwards here when passed the number itself
+     */
+    [[nodiscard]] big_int square() const noexcept;
+
+    /**
+     * @brief Adds a native integer without converting it to a big_int first
+     * @tparam T any integral type up to 64 bits except bool
+     * @param value the value to add
+     * @return the sum
+     */
+    template <detail::small_integer T> [[nodiscard]] big_int add_small(T value) const noexcept {
+        const auto [negative, magnitude] = sign_magnitude(value);
+        return add_small_impl(negative, magnitude);
+    }
+
+    /**
+     * @brief Subtracts a native integer without converting it to a big_int first
+     * @tparam T any integral type up to 64 bits except bool
+     * @param value the value to subtract
+     * @return the difference
+     */
+    template <detail::small_integer T> [[nodiscard]] big_int sub_small(T value) const noexcept {
+        const auto [negative, magnitude] = sign_magnitude(value);
+        return add_small_impl(!negative && magnitude != 0, magnitude);
+    }
+
+    /**
+     * @brief Multiplies by a native integer with a single-limb kernel
+     * @tparam T any integral type up to 64 bits except bool
+     * @param value the factor
+     * @return the product
+     */
+    template <detail::small_integer T> [[nodiscard]] big_int mul_small(T value) const noexcept {
+        const auto [negative, magnitude] = sign_magnitude(value);
+        return mul_small_impl(negative, magnitude);
+    }
+
+    /**
+     * @brief Divides by a native integer with a single-limb kernel
+     * @tparam T any integral type up to 64 bits except bool
+     * @param value the divisor
+     * @return quotient (truncated towards zero) and remainder (sign of the dividend), or DivisionByZero
+     */
+    template <detail::small_integer T>
+    [[nodiscard]] std::expected<std::pair<big_int, big_int>, errors::ArithmeticError> divmod_small(T value
+    ) const noexcept {
+        const auto [negative, magnitude] = sign_magnitude(value);
+        return divmod_small_impl(negative, magnitude);
+    }
+
+    /**
+     * @brief Quotient of a division by a native integer, see divmod_small
+     */
+    template <detail::small_integer T>
+    [[nodiscard]] std::expected<big_int, errors::ArithmeticError> div_small(T value) const noexcept {
+        auto result = divmod_small(value);
+        if (!result) {
+            return std::unexpected(result.error());
+        }
+        return std::move(result->first);
+    }
+
+    /**
+     * @brief Remainder of a division by a native integer, see divmod_small
+     */
+    template <detail::small_integer T>
+    [[nodiscard]] std::expected<big_int, errors::ArithmeticError> mod_small(T value) const noexcept {
+        // the remainder takes the sign of the dividend, so the divisor's sign never matters
+        return mod_small_impl(sign_magnitude(value).second);
+    }
+
     /**
      * @brief Returns the absolute value of the number
      * @return the absolute value of the number
@@ -150,17 +412,92 @@ class big_int {
      */
     [[nodiscard]] big_int negate() const;
 
-    // Operators
+    // Operators; the compound assignments also take views of limbs held elsewhere
     [[nodiscard]] big_int  operator+(const big_int &other) const noexcept;
-    big_int                operator+=(const big_int &other) noexcept;
+    big_int               &operator+=(big_int_view other) noexcept;
     [[nodiscard]] big_int  operator-(const big_int &other) const noexcept;
-    big_int                operator-=(const big_int &other) noexcept;
-    [[nodiscard]] big_int  operator-() const noexcept; // unary minus
+    big_int               &operator-=(big_int_view other) noexcept;
+    [[nodiscard]] big_int  operator-() const & noexcept; // unary minus
+    [[nodiscard]] big_int  operator-() && noexcept;      // flips the sign of the temporary in place
     [[nodiscard]] big_int  operator*(const big_int &other) const noexcept;
+    big_int               &operator*=(big_int_view other) noexcept;
     [[nodiscard]] big_int  operator/(const big_int &other) const;
     [[nodiscard]] big_int  operator%(const big_int &other) const;
-    big_int               &operator/=(const big_int &other);
-    big_int               &operator%=(const big_int &other);
+    big_int               &operator/=(big_int_view other);
+    big_int               &operator%=(big_int_view other);
+
+    // Rvalue operands lend their limb buffer to the result instead of a fresh one being allocated
+    friend big_int operator+(big_int &&lhs, const big_int &rhs) noexcept;
+    friend big_int operator+(const big_int &lhs, big_int &&rhs) noexcept;
+    friend big_int operator+(big_int &&lhs, big_int &&rhs) noexcept;
+    friend big_int operator-(big_int &&lhs, const big_int &rhs) noexcept;
+    friend big_int operator-(const big_int &lhs, big_int &&rhs) noexcept;
+    friend big_int operator-(big_int &&lhs, big_int &&rhs) noexcept;
+
+    // Mixed operators with native integers, backed by the scalar fast paths. The rvalue overloads work in
+    // place, and are needed anyway: without them a temporary plus an int is ambiguous against the
+    // buffer-donating operators above
+    template <detail::small_integer T> [[nodiscard]] big_int operator+(T value) const & noexcept {
+        return add_small(value);
+    }
+    template <detail::small_integer T> [[nodiscard]] big_int operator+(T value) && noexcept {
+        return std::move(*this += value);
+    }
+    template <detail::small_integer T> [[nodiscard]] big_int operator-(T value) const & noexcept {
+        return sub_small(value);
+    }
+    template <detail::small_integer T> [[nodiscard]] big_int operator-(T value) && noexcept {
+        return std::move(*this -= value);
+    }
+    template <detail::small_integer T> [[nodiscard]] big_int operator*(T value) const & noexcept {
+        return mul_small(value);
+    }
+    template <detail::small_integer T> [[nodiscard]] big_int operator*(T value) && noexcept {
+        return std::move(*this *= value);
+    }
+    template <detail::small_integer T> [[nodiscard]] big_int operator/(T value) const {
+        return value_or_throw(div_small(value));
+    }
+    template <detail::small_integer T> [[nodiscard]] big_int operator%(T value) const {
+        return value_or_throw(mod_small(value));
+    }
+    template <detail::small_integer T> big_int &operator+=(T value) noexcept {
+        const auto [negative, magnitude] = sign_magnitude(value);
+        return add_small_assign(negative, magnitude);
+    }
+    template <detail::small_integer T> big_int &operator-=(T value) noexcept {
+        const auto [negative, magnitude] = sign_magnitude(value);
+        return add_small_assign(!negative && magnitude != 0, magnitude);
+    }
+    template <detail::small_integer T> big_int &operator*=(T value) noexcept {
+        const auto [negative, magnitude] = sign_magnitude(value);
+        return mul_small_assign(negative, magnitude);
+    }
+    template <detail::small_integer T> big_int &operator/=(T value) {
+        *this = value_or_throw(div_small(value));
+        return *this;
+    }
+    template <detail::small_integer T> big_int &operator%=(T value) {
+        *this = value_or_throw(mod_small(value));
+        return *this;
+    }
+    template <detail::small_integer T> [[nodiscard]] friend big_int operator+(T lhs, const big_int &rhs) noexcept {
+        return rhs.add_small(lhs);
+    }
+    template <detail::small_integer T> [[nodiscard]] friend big_int operator-(T lhs, const big_int &rhs) noexcept {
+        return rhs.negate().add_small(lhs);
+    }
+    template <detail::small_integer T> [[nodiscard]] friend big_int operator+(T lhs, big_int &&rhs) noexcept {
+        return std::move(rhs += lhs);
+    }
+    template <detail::small_integer T> [[nodiscard]] friend big_int operator-(T lhs, big_int &&rhs) noexcept {
+        big_int negated = -std::move(rhs);
+        return std::move(negated += lhs);
+    }
+    template <detail::small_integer T> [[nodiscard]] friend big_int operator*(T lhs, const big_int &rhs) noexcept {
+        return rhs.mul_small(lhs);
+    }
+
     [[nodiscard]] explicit operator bool() const noexcept;
     friend std::ostream   &operator<<(std::ostream &os, const big_int &bi);
     friend std::istream   &operator>>(std::istream &is, big_int &bi);
@@ -170,17 +507,157 @@ class big_int {
     [[nodiscard]] bool                 operator==(const big_int &other) const;
 
   private:
-    // private implementation pointer (PImpl)
-    std::unique_ptr<detail::big_int_impl> impl_;
+    // in-place storage for the implementation (fast PImpl): big_int_impl stays opaque, but lives
+    // inside the object instead of behind a heap pointer. The size is checked in big_int.cpp
+    static constexpr std::size_t impl_size  = 80;
+    static constexpr std::size_t impl_align = 8;
+
+    alignas(impl_align) std::byte impl_storage_[impl_size];
+
+    [[nodiscard]] detail::big_int_impl       &impl() noexcept;
+    [[nodiscard]] const detail::big_int_impl &impl() const noexcept;
 
     // Private constructor for internal use
-    explicit big_int(std::unique_ptr<detail::big_int_impl> impl);
+    explicit big_int(detail::big_int_impl &&impl) noexcept;
+
+    // Splits a native integer into sign and magnitude for the non-template scalar kernels
+    template <detail::small_integer T> static constexpr std::pair<bool, std::uint64_t> sign_magnitude(T value) noexcept {
+        if constexpr (std::is_signed_v<T>) {
+            const auto magnitude = static_cast<std::uint64_t>(value);
+            return value < 0 ? std::pair{true, 0 - magnitude} : std::pair{false, magnitude};
+        } else {
+            return {false, static_cast<std::uint64_t>(value)};
+        }
+    }
+
+    [[nodiscard]] big_int add_small_impl(bool negative, std::uint64_t magnitude) const noexcept;
+    [[nodiscard]] big_int mul_small_impl(bool negative, std::uint64_t magnitude) const noexcept;
+    // In-place counterparts: the limb buffer only grows when a carry runs past the top limb
+    big_int &add_small_assign(bool negative, std::uint64_t magnitude) noexcept;
+    big_int &mul_small_assign(bool negative, std::uint64_t magnitude) noexcept;
+    [[nodiscard]] std::expected<std::pair<big_int, big_int>, errors::ArithmeticError> divmod_small_impl(
+      bool          negative,
+      std::uint64_t magnitude
+    ) const noexcept;
+    // The remainder alone: folds it down the limbs without storing a quotient
+    [[nodiscard]] std::expected<big_int, errors::ArithmeticError> mod_small_impl(std::uint64_t magnitude) const noexcept;
+
+    // Characters format_to writes through a stack buffer before falling back to to_string
+    static constexpr std::size_t format_buffer_size = 256;
+
+    // Unwraps the result of a fallible operation, throwing std::domain_error like operator/ does
+    [[nodiscard]] static big_int value_or_throw(std::expected<big_int, errors::ArithmeticError> &&result);
 
     // access struct: allows implementations to access private fields
     friend struct detail::big_int_access;
 };
 
+// Redeclared here because an attribute on a friend declaration that is not a definition is ignored
+[[nodiscard]] big_int operator+(big_int &&lhs, const big_int &rhs) noexcept;
+[[nodiscard]] big_int operator+(const big_int &lhs, big_int &&rhs) noexcept;
+[[nodiscard]] big_int operator+(big_int &&lhs, big_int &&rhs) noexcept;
+[[nodiscard]] big_int operator-(big_int &&lhs, const big_int &rhs) noexcept;
+[[nodiscard]] big_int operator-(const big_int &lhs, big_int &&rhs) noexcept;
+[[nodiscard]] big_int operator-(big_int &&lhs, big_int &&rhs) noexcept;
+
 std::ostream &operator<<(std::ostream &os, const big_int &bi);
 std::istream &operator>>(std::istream &is, big_int &bi);
 
-} // namespace arbys::bignum
\ No newline at end of file
+/**
+ * @brief A divisor prepared for dividing many numbers by it, such as a modulus reduced by in a loop
+ *
+ * Division first shifts the divisor until its top bit is set and needs the reciprocal of its top limb;
+ * a divisor does both once, and every quotient limb then costs multiplications rather than a hardware
+ * division. Results match big_int's: the quotient truncates towards zero and the remainder takes the
+ * sign of the dividend. For moduli of thousands of limbs, barrett_reducer is faster.
+ */
+class big_int::divisor {
+  public:
+    /**
+     * @brief Prepares value for division
+     * @throws std::domain_error if value is zero
+     */
+    explicit divisor(big_int_view value);
+
+    /**
+     * @brief The divisor as given
+     */
+    [[nodiscard]] const big_int &value() const noexcept { return value_; }
+
+    /**
+     * @brief Quotient and remainder of dividend by the divisor, as big_int::div_mod
+     */
+    [[nodiscard]] std::pair<big_int, big_int> div_mod(big_int_view dividend) const;
+
+    /**
+     * @brief Quotient of dividend by the divisor, truncated towards zero
+     */
+    [[nodiscard]] big_int div(big_int_view dividend) const;
+
+    /**
+     * @brief Remainder of dividend by the divisor, with the sign of dividend
+     */
+    [[nodiscard]] big_int mod(big_int_view dividend) const;
+
+  private:
+    big_int   value_;
+    big_int   normalized_; // |value_| shifted left until the top bit of its top limb is set, over the zero
+                           // limbs that pad it to the recursive division's block size
+    limb_type reciprocal_; // of the top limb of normalized_
+    unsigned  shift_;
+};
+
+[[nodiscard]] big_int operator/(big_int_view dividend, const big_int::divisor &divisor);
+[[nodiscard]] big_int operator%(big_int_view dividend, const big_int::divisor &divisor);
+
+/**
+ * @brief Barrett reduction modulo a fixed value, for loops that reduce many numbers by one modulus
+ *
+ * Construction computes floor(B^2n / |modulus|) for the n-limb modulus by Newton iteration, once. A value
+ * below B^2n, which covers every product of two values below the modulus, then reduces with two
+ * multiplications and at most two subtractions; longer values take one such step per n limbs. reduce and
+ * mul_mod keep only the low limbs of the remainder and never build a quotient. That is about 1.1 to 1.7
+ * times as fast as x % modulus from 50 limbs up, the gap widening with the size; shorter moduli divide as
+ * x % modulus does, since two full multiplications cost more there than the division. Results match
+ * big_int's: the quotient truncates towards zero and the remainder takes the sign of the value.
+ */
+class barrett_reducer {
+  public:
+    /**
+     * @brief Prepares the reciprocal of modulus
+     * @throws std::domain_error if modulus is zero
+     */
+    explicit barrett_reducer(big_int_view modulus);
+
+    /**
+     * @brief The modulus as given
+     */
+    [[nodiscard]] const big_int &modulus() const noexcept { return modulus_; }
+
+    /**
+     * @brief x % modulus, with the sign of x
+     */
+    [[nodiscard]] big_int reduce(big_int_view x) const;
+
+    /**
+     * @brief Quotient and remainder of x by the modulus, as big_int::div_mod
+     */
+    [[nodiscard]] std::pair<big_int, big_int> div_mod(big_int_view x) const;
+
+    /**
+     * @brief lhs * rhs % modulus, with the sign of the product
+     */
+    [[nodiscard]] big_int mul_mod(big_int_view lhs, big_int_view rhs) const;
+
+  private:
+    big_int modulus_;
+    big_int reciprocal_; // floor(B^2n / |modulus_|), or zero for moduli below detail::barrett_threshold
+};
+
+} // namespace arbys::bignum
+
+template <> struct std::hash<arbys::bignum::big_int> {
+    std::size_t operator()(const arbys::bignum::big_int &value) const noexcept {
+        return arbys::bignum::big_int_view(value).hash();
+    }
+};
\ No newline at end of file
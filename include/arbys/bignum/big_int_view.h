@@ -0,0 +1,136 @@
+#pragma once
+
+#include <charconv>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <type_traits>
+
+// Limb width, chosen at configure time with -DARBYS_BIGNUM_LIMB_BITS=32|64
+#ifndef ARBYS_BIGNUM_LIMB_BITS
+#define ARBYS_BIGNUM_LIMB_BITS 32
+#endif
+
+namespace arbys::bignum {
+
+/// One limb of a number: a digit in base 2^ARBYS_BIGNUM_LIMB_BITS
+using limb_type = std::conditional_t<ARBYS_BIGNUM_LIMB_BITS == 64, std::uint64_t, std::uint32_t>;
+
+class big_int;
+
+/**
+ * @brief Read-only view of a number whose limbs live elsewhere, such as in a memory-mapped table
+ *
+ * A view is a sign and a span of limbs, least significant first. It never owns or copies the limbs, so
+ * the memory must outlive the view. Every big_int converts to a view implicitly; do not keep a view of
+ * a temporary big_int past the end of the expression.
+ */
+class big_int_view {
+  public:
+    /**
+     * @brief Views zero
+     */
+    constexpr big_int_view() noexcept = default;
+
+    /**
+     * @brief Views the limbs of a big_int
+     * @param value must outlive the view and not change while it is in use
+     */
+    big_int_view(const big_int &value) noexcept;
+
+    /**
+     * @brief Views limbs stored elsewhere
+     * @param negative the sign; ignored for zero
+     * @param limbs the magnitude, least significant limb first; zero limbs at the top are skipped, and an
+     * empty span is zero
+     */
+    constexpr big_int_view(const bool negative, std::span<const limb_type> limbs) noexcept {
+        while (!limbs.empty() && limbs.back() == 0) {
+            limbs = limbs.first(limbs.size() - 1);
+        }
+        if (!limbs.empty()) {
+            limbs_    = limbs;
+            negative_ = negative;
+        }
+    }
+
+    /**
+     * @brief Returns weather or not the number is negative
+     */
+    [[nodiscard]] constexpr bool is_negative() const noexcept { return negative_; }
+
+    /**
+     * @brief Returns weather or not the number is zero
+     */
+    [[nodiscard]] constexpr bool is_zero() const noexcept { return limbs_.size() == 1 && limbs_[0] == 0; }
+
+    /**
+     * @brief The magnitude, least significant limb first, without zero limbs at the top
+     * @return at least one limb; zero is a single zero limb
+     */
+    [[nodiscard]] constexpr std::span<const limb_type> limbs() const noexcept { return limbs_; }
+
+    /**
+     * @brief Views the same limbs without the sign
+     */
+    [[nodiscard]] constexpr big_int_view abs() const noexcept {
+        big_int_view result = *this;
+        result.negative_    = false;
+        return result;
+    }
+
+    /**
+     * @brief Converts the number to a std::string in base 10, as big_int::to_string
+     */
+    [[nodiscard]] std::string to_string() const;
+
+    /**
+     * @brief Converts the number to a std::string in any base from 2 to 36, as big_int::to_string
+     * @throws std::invalid_argument if base is outside [2, 36]
+     */
+    [[nodiscard]] std::string to_string(int base) const;
+
+    /**
+     * @brief Upper bound on the characters to_chars writes, as big_int::max_chars
+     */
+    [[nodiscard]] std::size_t max_chars(int base = 10) const noexcept;
+
+    /**
+     * @brief Writes the number into [first, last), as big_int::to_chars
+     */
+    std::to_chars_result to_chars(char *first, char *last, int base = 10) const;
+
+    /**
+     * @brief Hash of the value, equal for equal numbers whatever holds their limbs; std::hash<big_int>
+     * and std::hash<big_int_view> return it
+     */
+    [[nodiscard]] std::size_t hash() const noexcept;
+
+  private:
+    // the single limb of zero, so that every view has at least one limb, as a big_int does
+    static constexpr limb_type zero_limb = 0;
+
+    std::span<const limb_type> limbs_{&zero_limb, 1};
+    bool                       negative_ = false;
+};
+
+// Arithmetic on views reads both operands in place; only the result is allocated. A big_int operand
+// converts to a view, so these also cover a view with a big_int on either side
+[[nodiscard]] big_int operator+(big_int_view lhs, big_int_view rhs);
+[[nodiscard]] big_int operator-(big_int_view lhs, big_int_view rhs);
+[[nodiscard]] big_int operator*(big_int_view lhs, big_int_view rhs);
+// throw std::domain_error on division by zero, like big_int's
+[[nodiscard]] big_int operator/(big_int_view lhs, big_int_view rhs);
+[[nodiscard]] big_int operator%(big_int_view lhs, big_int_view rhs);
+
+[[nodiscard]] std::strong_ordering operator<=>(big_int_view lhs, big_int_view rhs) noexcept;
+[[nodiscard]] bool                 operator==(big_int_view lhs, big_int_view rhs) noexcept;
+
+} // namespace arbys::bignum
+
+template <> struct std::hash<arbys::bignum::big_int_view> {
+    std::size_t operator()(const arbys::bignum::big_int_view value) const noexcept { return value.hash(); }
+};
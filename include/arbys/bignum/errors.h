@@ -13,6 +13,7 @@ enum class ParseError {
     InvalidSeparator,
     NoDigits,
     InvalidBase,
+    UnreadableFile,
 };
 
 /// Errors that can occur during arithmetic operations
@@ -36,6 +37,8 @@ enum class ArithmeticError {
         return "No digits found";
     case ParseError::InvalidBase:
         return "Invalid base";
+    case ParseError::UnreadableFile:
+        return "Input file could not be read";
     }
     return "Unknown parse error";
 }
@@ -1,12 +1,233 @@
 #pragma once
 
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
 #include <format>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 #include "big_int.h"
 
+/**
+ * @brief std::format support for big_int, following the standard integer format spec
+ *
+ *   [[fill]align][sign][#][0][width][grouping][type]
+ *
+ * - fill, align: any single character (UTF-8 included) other than { and }, then <, > or ^;
+ *   numbers are right-aligned by default
+ * - sign: + (always), - (negative only, the default) or space (a space in front of non-negatives)
+ * - #: base prefix 0b/0B, 0 (octal, non-zero values only) or 0x/0X
+ * - 0: pad with zeros between the sign/prefix and the digits; ignored when an alignment is given
+ * - width: a number, or {} / {n} to take it from an integer argument
+ * - grouping: , or _ between every three decimal digits, or _ between every four digits of b/B/o/x/X;
+ *   locale-independent, unlike L, which is rejected
+ * - type: d (default), b, B, o, x or X
+ *
+ * The digits go through a stack buffer straight into the output iterator; only values past a few
+ * hundred limbs (stack_chars characters) use a heap buffer.
+ */
 template <> struct std::formatter<arbys::bignum::big_int> {
-    constexpr auto parse(std::format_parse_context &ctx) { return ctx.begin(); }
+    constexpr std::format_parse_context::iterator parse(std::format_parse_context &ctx) {
+        auto       it  = ctx.begin();
+        const auto end = ctx.end();
+        if (it == end || *it == '}') {
+            return it;
+        }
 
-    auto format(const arbys::bignum::big_int &bi, std::format_context &ctx) const { return bi.format_to(ctx.out()); }
+        // fill and align: the fill is one code point, so look past its UTF-8 continuation bytes
+        const auto fill_size = code_point_size(*it);
+        if (end - it > static_cast<std::ptrdiff_t>(fill_size) && is_align(it[fill_size])) {
+            if (*it == '{' || *it == '}') {
+                throw std::format_error("invalid fill character in big_int format spec");
+            }
+            std::copy_n(it, fill_size, fill_);
+            fill_size_ = fill_size;
+            align_     = it[fill_size];
+            it += static_cast<std::ptrdiff_t>(fill_size) + 1;
+        } else if (is_align(*it)) {
+            align_ = *it++;
+        }
+
+        if (it != end && (*it == '+' || *it == '-' || *it == ' ')) {
+            sign_ = *it++;
+        }
+        if (it != end && *it == '#') {
+            alternate_ = true;
+            ++it;
+        }
+        if (it != end && *it == '0') {
+            zero_pad_ = true;
+            ++it;
+        }
+
+        if (it != end && *it >= '1' && *it <= '9') {
+            width_ = parse_number(it, end);
+        } else if (it != end && *it == '{') {
+            ++it;
+            if (it != end && *it == '}') {
+                width_arg_ = static_cast<int>(ctx.next_arg_id());
+            } else {
+                width_arg_ = static_cast<int>(parse_number(it, end));
+                ctx.check_arg_id(static_cast<std::size_t>(width_arg_));
+            }
+            if (it == end || *it != '}') {
+                throw std::format_error("invalid dynamic width in big_int format spec");
+            }
+            ++it;
+        }
+
+        if (it != end && (*it == ',' || *it == '_')) {
+            grouping_ = *it++;
+        }
+        if (it != end && *it == '.') {
+            throw std::format_error("big_int format spec does not take a precision");
+        }
+        if (it != end && *it == 'L') {
+            throw std::format_error("big_int format spec has no locale-specific form; group with , or _");
+        }
+        if (it != end && std::string_view("bBodxX").contains(*it)) {
+            type_ = *it++;
+        }
+        if (it == end || *it != '}') {
+            throw std::format_error("invalid big_int format spec");
+        }
+        if (grouping_ == ',' && type_ != 'd') {
+            throw std::format_error("',' grouping is only for decimal; use '_'");
+        }
+        return it;
+    }
+
+    std::format_context::iterator format(const arbys::bignum::big_int &value, std::format_context &ctx) const {
+        const int base = type_ == 'd' ? 10 : type_ == 'o' ? 8 : (type_ == 'x' || type_ == 'X') ? 16 : 2;
+
+        // |value| in the base; to_chars puts a '-' in front of negatives, which the sign handling replaces
+        char        stack[stack_chars];
+        std::string heap;
+        char       *first = stack;
+        const auto  bound = value.max_chars(base);
+        if (bound > stack_chars) {
+            heap.resize(bound);
+            first = heap.data();
+        }
+        const char *digits = first + (value.is_negative() ? 1 : 0);
+        char       *last   = value.to_chars(first, first + bound, base).ptr;
+        if (type_ == 'X') {
+            std::transform(first, last, first, [](const char c) {
+                return c >= 'a' && c <= 'f' ? static_cast<char>(c - 'a' + 'A') : c;
+            });
+        }
+
+        char        prefix[3];
+        std::size_t prefix_size = 0;
+        if (value.is_negative()) {
+            prefix[prefix_size++] = '-';
+        } else if (sign_ == '+' || sign_ == ' ') {
+            prefix[prefix_size++] = sign_;
+        }
+        if (alternate_ && type_ != 'd' && !(type_ == 'o' && value.is_zero())) {
+            prefix[prefix_size++] = '0';
+            if (type_ != 'o') {
+                prefix[prefix_size++] = type_;
+            }
+        }
+
+        const auto        count   = static_cast<std::size_t>(last - digits);
+        const std::size_t group   = type_ == 'd' ? 3 : 4;
+        const std::size_t grouped = count + (grouping_ != 0 ? (count - 1) / group : 0);
+        const std::size_t width   = width_arg_ >= 0 ? dynamic_width(ctx) : width_;
+        const std::size_t size    = prefix_size + grouped;
+        const std::size_t padding = width > size ? width - size : 0;
+
+        auto out = ctx.out();
+        if (zero_pad_ && align_ == 0) {
+            out = std::copy_n(prefix, prefix_size, out);
+            out = std::fill_n(out, padding, '0');
+            return write_grouped(digits, count, group, out);
+        }
+
+        const std::size_t before = align_ == '<' ? 0 : align_ == '^' ? padding / 2 : padding;
+        out                      = write_fill(out, before);
+        out                      = std::copy_n(prefix, prefix_size, out);
+        out                      = write_grouped(digits, count, group, out);
+        return write_fill(out, padding - before);
+    }
+
+  private:
+    // Values with up to this many characters are formatted without touching the heap
+    static constexpr std::size_t stack_chars = 4096;
+
+    static constexpr bool is_align(const char c) noexcept { return c == '<' || c == '>' || c == '^'; }
+
+    static constexpr std::size_t code_point_size(const char lead) noexcept {
+        const auto byte = static_cast<unsigned char>(lead);
+        return byte < 0xC0 ? 1 : byte < 0xE0 ? 2 : byte < 0xF0 ? 3 : 4;
+    }
+
+    static constexpr std::size_t parse_number(
+      std::format_parse_context::iterator       &it,
+      const std::format_parse_context::iterator end
+    ) {
+        std::size_t value = 0;
+        for (; it != end && *it >= '0' && *it <= '9'; ++it) {
+            value = value * 10 + static_cast<std::size_t>(*it - '0');
+        }
+        return value;
+    }
+
+    std::size_t dynamic_width(std::format_context &ctx) const {
+        return std::visit_format_arg(
+          []<class T>(const T arg) -> std::size_t {
+              if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>) {
+                  if constexpr (std::is_signed_v<T>) {
+                      if (arg < 0) {
+                          throw std::format_error("negative width for big_int");
+                      }
+                  }
+                  return static_cast<std::size_t>(arg);
+              } else {
+                  throw std::format_error("width argument for big_int is not an integer");
+              }
+          },
+          ctx.arg(static_cast<std::size_t>(width_arg_))
+        );
+    }
+
+    std::format_context::iterator write_fill(std::format_context::iterator out, const std::size_t count) const {
+        for (std::size_t i = 0; i < count; ++i) {
+            out = std::copy_n(fill_, fill_size_, out);
+        }
+        return out;
+    }
+
+    std::format_context::iterator write_grouped(
+      const char                   *digits,
+      const std::size_t             count,
+      const std::size_t             group,
+      std::format_context::iterator out
+    ) const {
+        if (grouping_ == 0) {
+            return std::copy_n(digits, count, out);
+        }
+        // the leading group takes the remainder, every later one is full
+        std::size_t next = count % group == 0 ? group : count % group;
+        out              = std::copy_n(digits, next, out);
+        for (; next < count; next += group) {
+            *out++ = grouping_;
+            out    = std::copy_n(digits + next, group, out);
+        }
+        return out;
+    }
+
+    char        fill_[4]   = {' '};
+    std::size_t fill_size_ = 1;
+    char        align_     = 0;
+    char        sign_      = '-';
+    bool        alternate_ = false;
+    bool        zero_pad_  = false;
+    std::size_t width_     = 0;
+    int         width_arg_ = -1;
+    char        grouping_  = 0;
+    char        type_      = 'd';
 };
@@ -2,46 +2,66 @@
 #include "../detail/big_int_internal.h"
 #include "../detail/config.h"
 #include "../detail/detail.h"
+#include "../detail/mapped_file.h"
 
 #include <algorithm>
+#include <bit>
 #include <cctype>
 #include <cstdlib>
+#include <functional>
 #include <istream>
 #include <ranges>
+#include <span>
 #include <stdexcept>
+#include <string_view>
+#include <thread>
 
 namespace arbys::bignum {
 
-big_int::big_int() : impl_(std::make_unique<detail::big_int_impl>()) {}
+big_int::big_int() {
+    static_assert(sizeof(detail::big_int_impl) <= impl_size, "big_int::impl_size is too small for big_int_impl");
+    static_assert(alignof(detail::big_int_impl) <= impl_align, "big_int::impl_align is too small for big_int_impl");
+    ::new (impl_storage_) detail::big_int_impl();
+}
 
-big_int::~big_int() = default;
+big_int::~big_int() { impl().~big_int_impl(); }
 
-big_int::big_int(const big_int &other) : impl_(std::make_unique<detail::big_int_impl>(*other.impl_)) {}
+big_int::big_int(const big_int &other) { ::new (impl_storage_) detail::big_int_impl(other.impl()); }
 
-big_int::big_int(big_int &&other) noexcept = default;
+big_int::big_int(big_int &&other) noexcept { ::new (impl_storage_) detail::big_int_impl(std::move(other.impl())); }
 
 big_int &big_int::operator=(const big_int &other) {
     if (this != &other) {
-        impl_ = std::make_unique<detail::big_int_impl>(*other.impl_);
+        impl() = other.impl();
     }
     return *this;
 }
 
-big_int &big_int::operator=(big_int &&other) noexcept = default;
+big_int &big_int::operator=(big_int &&other) noexcept {
+    impl() = std::move(other.impl());
+    return *this;
+}
 
-big_int::big_int(std::unique_ptr<detail::big_int_impl> impl) : impl_(std::move(impl)) {}
+big_int::big_int(detail::big_int_impl &&impl) noexcept { ::new (impl_storage_) detail::big_int_impl(std::move(impl)); }
+
+big_int::big_int(const big_int_view value) {
+    ::new (impl_storage_)
+      detail::big_int_impl(value.is_negative(), detail::limb_vector(value.limbs().begin(), value.limbs().end()));
+}
+
+big_int_view::big_int_view(const big_int &value) noexcept : limbs_(value.limbs()), negative_(value.is_negative()) {}
 
 template <std::integral T> big_int big_int::from_integer(T value) {
     bool is_negative   = value < 0;
     using Unsigned     = std::make_unsigned_t<T>;
     Unsigned abs_value = is_negative ? -static_cast<Unsigned>(value) : static_cast<Unsigned>(value);
 
-    std::vector<detail::limb_t> limbs;
+    detail::limb_vector limbs;
 
     if (abs_value == 0) {
         limbs.push_back(0);
     } else {
-        // Convert to base 2^32 representation
+        // Convert to base 2^LIMB_BITS representation
         constexpr detail::dlimb_t LIMB_MASK = (detail::dlimb_t{1} << detail::LIMB_BITS) - 1;
 
         while (abs_value != 0) {
@@ -54,7 +74,7 @@ template <std::integral T> big_int big_int::from_integer(T value) {
         }
     }
 
-    return big_int(std::make_unique<detail::big_int_impl>(is_negative, std::move(limbs)));
+    return big_int(detail::big_int_impl(is_negative, std::move(limbs)));
 }
 
 // Explicit instantiations for common integer types
@@ -65,6 +85,23 @@ template big_int big_int::from_integer<unsigned int>(unsigned int);
 template big_int big_int::from_integer<unsigned long>(unsigned long);
 template big_int big_int::from_integer<unsigned long long>(unsigned long long);
 
+big_int big_int::from_limbs(std::vector<limb_type> &&limbs, const bool negative) {
+    if (limbs.empty()) {
+        return big_int();
+    }
+    return big_int(detail::big_int_impl(negative, detail::limb_vector(std::move(limbs))));
+}
+
+std::span<const limb_type> big_int::limbs() const noexcept { return detail::big_int_access::limb_span(*this); }
+
+std::vector<limb_type> big_int::release_limbs() {
+    const size_t           length = impl().length_;
+    std::vector<limb_type> limbs  = impl().limbs_.release();
+    limbs.resize(length);
+    impl().set_zero();
+    return limbs;
+}
+
 std::expected<big_int, errors::ParseError> big_int::from_string(std::string_view input) {
     input = detail::trim_view(input);
     if (input.empty()) {
@@ -168,31 +205,213 @@ std::expected<big_int, errors::ParseError> big_int::from_string(
     return detail::parse_limbs(compact, is_negative);
 }
 
-bool big_int::is_negative() const noexcept { return impl_->is_negative_; }
+std::expected<big_int, errors::ParseError> big_int::from_file(
+  const std::filesystem::path &path,
+  const std::string_view       separator,
+  unsigned                     threads
+) {
+    const detail::mapped_file file(path);
+    if (!file.is_open()) {
+        return std::unexpected(errors::ParseError::UnreadableFile);
+    }
+
+    std::string_view input = detail::trim_view(file.contents());
+    if (input.empty()) {
+        return std::unexpected(errors::ParseError::EmptyInput);
+    }
+
+    bool is_negative = false;
+    if (input.front() == '-') {
+        is_negative = true;
+        input.remove_prefix(1);
+    } else if (input.front() == '+') {
+        input.remove_prefix(1);
+    }
+
+    if (input.empty()) {
+        return std::unexpected(errors::ParseError::NoDigits);
+    }
 
-bool big_int::is_zero() const noexcept { return impl_->length_ == 1 && impl_->limbs_[0] == 0; }
+    if (threads == 0) {
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    return detail::parse_decimal_parallel(input, is_negative, separator, threads);
+}
+
+std::expected<big_int, errors::ParseError> big_int::from_string(std::string_view input, const int base) {
+    if (base < 2 || base > 36) {
+        return std::unexpected(errors::ParseError::InvalidBase);
+    }
 
-std::string big_int::to_string() const {
+    input = detail::trim_view(input);
+    if (input.empty()) {
+        return std::unexpected(errors::ParseError::EmptyInput);
+    }
+
+    bool is_negative = false;
+    if (input.front() == '-') {
+        is_negative = true;
+        input.remove_prefix(1);
+    } else if (input.front() == '+') {
+        input.remove_prefix(1);
+    }
+
+    if (input.empty()) {
+        return std::unexpected(errors::ParseError::NoDigits);
+    }
+
+    return detail::parse_limbs_base(input, is_negative, static_cast<unsigned>(base));
+}
+
+bool big_int::is_negative() const noexcept { return impl().is_negative_; }
+
+bool big_int::is_zero() const noexcept { return impl().length_ == 1 && impl().limbs_[0] == 0; }
+
+std::string big_int::to_string() const { return big_int_view(*this).to_string(); }
+
+std::string big_int::to_string(const int base) const { return big_int_view(*this).to_string(base); }
+
+std::size_t big_int::max_chars(const int base) const noexcept { return big_int_view(*this).max_chars(base); }
+
+std::to_chars_result big_int::to_chars(char *first, char *last, const int base) const {
+    return big_int_view(*this).to_chars(first, last, base);
+}
+
+std::string big_int_view::to_string() const {
     std::string s;
-    s.reserve(impl_->length_ * 10 + 1);
-    impl_->write_digits_to(std::back_inserter(s));
+    s.reserve(max_chars());
     if (is_negative()) {
-        s.insert(s.begin(), '-');
+        s.push_back('-');
     }
+    detail::append_digits(s, *this, 10);
     return s;
 }
 
+std::string big_int_view::to_string(const int base) const {
+    if (base < 2 || base > 36) {
+        throw std::invalid_argument(std::string(errors::to_string(errors::ParseError::InvalidBase)));
+    }
+
+    std::string s;
+    s.reserve(max_chars(base));
+    if (is_negative()) {
+        s.push_back('-');
+    }
+    detail::append_digits(s, *this, static_cast<unsigned>(base));
+    return s;
+}
+
+std::size_t big_int_view::max_chars(const int base) const noexcept {
+    if (base < 2 || base > 36) {
+        return 0;
+    }
+    return (is_negative() ? 1 : 0) + detail::digits_bound(*this, static_cast<unsigned>(base));
+}
+
+std::to_chars_result big_int_view::to_chars(char *first, char *last, const int base) const {
+    if (base < 2 || base > 36) {
+        return {last, std::errc::invalid_argument};
+    }
+
+    if (is_negative()) {
+        if (first == last) {
+            return {last, std::errc::value_too_large};
+        }
+        *first++ = '-';
+    }
+
+    char *end = detail::write_digits(first, last, *this, static_cast<unsigned>(base));
+    if (end == nullptr) {
+        return {last, std::errc::value_too_large};
+    }
+    return {end, std::errc{}};
+}
+
+std::size_t big_int_view::hash() const noexcept {
+    const auto             bytes = std::as_bytes(limbs_);
+    const std::string_view raw(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+    const std::size_t      h = std::hash<std::string_view>{}(raw);
+    return negative_ ? ~h : h;
+}
+
+std::from_chars_result big_int::from_chars(const char *first, const char *last, big_int &value, const int base) {
+    if (base < 2 || base > 36) {
+        return {first, std::errc::invalid_argument};
+    }
+
+    const bool             is_negative = first != last && *first == '-';
+    const std::string_view input(first + (is_negative ? 1 : 0), last);
+
+    const size_t digits = detail::digit_run(input, static_cast<unsigned>(base));
+    if (digits == 0) {
+        return {first, std::errc::invalid_argument};
+    }
+
+    // every character is a digit of the base, so the parse cannot fail
+    value = *detail::parse_limbs_base(input.substr(0, digits), is_negative, static_cast<unsigned>(base));
+    return {input.data() + digits, std::errc{}};
+}
+
+std::size_t big_int::byte_size(const byte_encoding encoding) const noexcept {
+    return detail::byte_size(*this, encoding);
+}
+
+std::vector<std::byte> big_int::to_bytes(const std::endian order, const byte_encoding encoding) const {
+    std::vector<std::byte> bytes(byte_size(encoding));
+    detail::write_bytes(bytes, *this, order, encoding);
+    return bytes;
+}
+
+std::expected<std::vector<std::byte>, errors::ArithmeticError> big_int::to_bytes(
+  const std::size_t   width,
+  const std::endian   order,
+  const byte_encoding encoding
+) const {
+    if (byte_size(encoding) > width) {
+        return std::unexpected(errors::ArithmeticError::Overflow);
+    }
+    std::vector<std::byte> bytes(width);
+    detail::write_bytes(bytes, *this, order, encoding);
+    return bytes;
+}
+
+std::expected<void, errors::ArithmeticError> big_int::to_bytes(
+  const std::span<std::byte> out,
+  const std::endian          order,
+  const byte_encoding        encoding
+) const {
+    if (byte_size(encoding) > out.size()) {
+        return std::unexpected(errors::ArithmeticError::Overflow);
+    }
+    detail::write_bytes(out, *this, order, encoding);
+    return {};
+}
+
+big_int big_int::from_bytes(
+  const std::span<const std::byte> bytes,
+  const std::endian                order,
+  const byte_encoding              encoding
+) {
+    return detail::read_bytes(bytes, order, encoding);
+}
+
 std::strong_ordering big_int::operator<=>(const big_int &other) const {
+    return big_int_view(*this) <=> big_int_view(other);
+}
+
+bool big_int::operator==(const big_int &other) const { return big_int_view(*this) == big_int_view(other); }
+
+std::strong_ordering operator<=>(const big_int_view lhs, const big_int_view rhs) noexcept {
     // Different signs
-    if (impl_->is_negative_ != other.impl_->is_negative_) {
-        return impl_->is_negative_ ? std::strong_ordering::less : std::strong_ordering::greater;
+    if (lhs.is_negative() != rhs.is_negative()) {
+        return lhs.is_negative() ? std::strong_ordering::less : std::strong_ordering::greater;
     }
 
     // Same sign
-    const std::strong_ordering abs_cmp = detail::cmp_abs(*this, other);
+    const std::strong_ordering abs_cmp = detail::cmp_abs(lhs, rhs);
 
     // Both negative
-    if (impl_->is_negative_) {
+    if (lhs.is_negative()) {
         if (abs_cmp == std::strong_ordering::less) {
             return std::strong_ordering::greater;
         }
@@ -204,104 +423,337 @@ std::strong_ordering big_int::operator<=>(const big_int &other) const {
     return abs_cmp;
 }
 
-bool big_int::operator==(const big_int &other) const {
-    return impl_->is_negative_ == other.impl_->is_negative_ && impl_->limbs_ == other.impl_->limbs_;
+bool operator==(const big_int_view lhs, const big_int_view rhs) noexcept {
+    return lhs.is_negative() == rhs.is_negative() && std::ranges::equal(lhs.limbs(), rhs.limbs());
 }
 
 big_int big_int::abs() const {
-    auto result          = std::make_unique<detail::big_int_impl>(*impl_);
-    result->is_negative_ = false;
-    return big_int(std::move(result));
+    big_int result                = *this;
+    result.impl().is_negative_ = false;
+    return result;
 }
 
 big_int big_int::negate() const {
-    auto result = std::make_unique<detail::big_int_impl>(*impl_);
+    big_int result = *this;
     if (!is_zero()) {
-        result->is_negative_ = !result->is_negative_;
+        result.impl().is_negative_ = !result.impl().is_negative_;
     }
-    return big_int(std::move(result));
+    return result;
 }
 
-big_int big_int::add(const big_int &other) const noexcept {
-    if (impl_->is_negative_ == other.impl_->is_negative_) {
-        big_int result             = detail::add_abs(*this, other);
-        result.impl_->is_negative_ = impl_->is_negative_;
-        result.impl_->normalize();
+namespace {
+
+// Limbs of a native magnitude, least significant first; `size` is 0 for zero
+struct small_limbs {
+    static constexpr std::size_t capacity = 64 / detail::LIMB_BITS;
+
+    detail::limb_t data[capacity]{};
+    std::size_t    size = 0;
+
+    explicit small_limbs(std::uint64_t magnitude) noexcept {
+        while (magnitude != 0) {
+            data[size++] = static_cast<detail::limb_t>(magnitude);
+            if constexpr (capacity > 1) {
+                magnitude >>= detail::LIMB_BITS;
+            } else {
+                magnitude = 0;
+            }
+        }
+    }
+
+    // the bound on size is spelled out so that release builds, without asserts, can see the copies stay
+    // inside data
+    [[nodiscard]] std::span<const detail::limb_t> span() const noexcept {
+        return std::span<const detail::limb_t, capacity>(data).first(std::min(size, capacity));
+    }
+
+    [[nodiscard]] detail::limb_vector to_vector() const { return detail::limb_vector(span().begin(), span().end()); }
+};
+
+// acc += magnitude (negated when `negative`), reusing acc's limb buffer; the buffer only grows when
+// the magnitude is longer or a carry runs past the top limb. magnitude may be acc's own limbs
+void add_in_place(detail::big_int_impl &acc, const bool negative, const std::span<const detail::limb_t> magnitude) {
+    if (magnitude.size() == 1 && magnitude[0] == 0) {
+        return;
+    }
+
+    auto        &limbs  = acc.limbs_;
+    const size_t length = acc.length_;
+
+    if (acc.is_negative_ == negative) {
+        // a magnitude longer than acc cannot be acc itself, so growing here leaves it valid
+        if (length < magnitude.size()) {
+            limbs.resize(magnitude.size());
+        }
+        const detail::limb_t carry = detail::add_limbs(limbs, limbs, magnitude);
+        if (carry != 0) {
+            limbs.push_back(carry);
+        }
+        acc.length_ = limbs.size();
+        return;
+    }
+
+    // different signs: the larger magnitude keeps its sign
+    if (detail::cmp_limbs({limbs.data(), length}, magnitude) >= 0) {
+        (void)detail::sub_limbs(limbs, limbs, magnitude);
+    } else {
+        limbs.resize(magnitude.size());
+        (void)detail::sub_limbs(limbs, magnitude, std::span<const detail::limb_t>(limbs.data(), length));
+        acc.length_      = magnitude.size();
+        acc.is_negative_ = negative;
+    }
+    acc.normalize();
+}
+
+// lhs + rhs with rhs taken as negative when `rhs_negative`, so sub() needs no negated copy of rhs
+big_int add_signed(const big_int_view lhs, const big_int_view rhs, const bool rhs_negative) {
+    if (lhs.is_negative() == rhs_negative) {
+        big_int result                                    = detail::add_abs(lhs, rhs);
+        detail::big_int_access::impl(result).is_negative_ = rhs_negative;
+        detail::big_int_access::impl(result).normalize();
         return result;
     }
 
     // Different signs
-    const std::strong_ordering cmp = detail::cmp_abs(*this, other);
+    const std::strong_ordering cmp = detail::cmp_abs(lhs, rhs);
 
     if (cmp == std::strong_ordering::equal) {
         return big_int{};
     }
 
     if (cmp == std::strong_ordering::greater) {
-        big_int result             = detail::sub_abs(*this, other);
-        result.impl_->is_negative_ = impl_->is_negative_;
+        big_int result                                    = detail::sub_abs(lhs, rhs);
+        detail::big_int_access::impl(result).is_negative_ = lhs.is_negative();
         return result;
     }
 
-    big_int result             = detail::sub_abs(other, *this);
-    result.impl_->is_negative_ = other.impl_->is_negative_;
+    big_int result                                    = detail::sub_abs(rhs, lhs);
+    detail::big_int_access::impl(result).is_negative_ = rhs_negative;
     return result;
 }
 
-big_int big_int::sub(const big_int &other) const noexcept { return add(other.negate()); }
-
-big_int big_int::mul(const big_int &other) const noexcept {
-    if (is_zero() || other.is_zero()) {
+big_int mul_signed(const big_int_view lhs, const big_int_view rhs) {
+    if (lhs.is_zero() || rhs.is_zero()) {
         return big_int();
     }
 
-    big_int result             = detail::mul_abs(*this, other);
-    result.impl_->is_negative_ = impl_->is_negative_ != other.impl_->is_negative_;
-    result.impl_->normalize();
+    // the same limbs on both sides, as in x * x, take the squaring kernels; a view and its abs() share
+    // limbs but not a sign, so the sign is still set from both operands
+    const bool same_limbs = lhs.limbs().data() == rhs.limbs().data() && lhs.limbs().size() == rhs.limbs().size();
+    big_int    result     = same_limbs ? detail::sqr_abs(lhs) : detail::mul_abs(lhs, rhs);
+    detail::big_int_access::impl(result).is_negative_ = lhs.is_negative() != rhs.is_negative();
+    detail::big_int_access::impl(result).normalize();
     return result;
 }
 
-std::expected<big_int, errors::ArithmeticError> big_int::div(const big_int &other) const noexcept {
-    if (other.is_zero())
+std::expected<big_int, errors::ArithmeticError> div_signed(const big_int_view lhs, const big_int_view rhs) noexcept {
+    if (rhs.is_zero())
         return std::unexpected(errors::ArithmeticError::DivisionByZero);
 
-    if (is_zero()) {
+    if (lhs.is_zero()) {
         return big_int(); // 0 / anything = 0 (except 0)
     }
 
-    auto result = detail::div_abs(*this, other);
+    auto result = detail::div_abs(lhs, rhs);
     if (!result) {
         return std::unexpected(result.error());
     }
 
     // Apply sign rules
-    const bool result_negative = impl_->is_negative_ != other.impl_->is_negative_;
+    const bool result_negative = lhs.is_negative() != rhs.is_negative();
     if (result_negative && !result->is_zero()) {
-        result->impl_->is_negative_ = true;
+        detail::big_int_access::impl(*result).is_negative_ = true;
     }
 
-    return *result;
+    return result;
 }
 
-std::expected<big_int, errors::ArithmeticError> big_int::mod(const big_int &other) const noexcept {
-    if (other.is_zero())
+std::expected<big_int, errors::ArithmeticError> mod_signed(const big_int_view lhs, const big_int_view rhs) noexcept {
+    if (rhs.is_zero())
         return std::unexpected(errors::ArithmeticError::DivisionByZero);
 
-    if (is_zero()) {
+    if (lhs.is_zero()) {
         return big_int(); // 0 % anything = 0 (except 0)
     }
 
-    auto result = detail::mod_abs(*this, other);
+    auto result = detail::mod_abs(lhs, rhs);
     if (!result) {
         return std::unexpected(result.error());
     }
 
     // Remainder has same sign as dividend
-    if (impl_->is_negative_ && !result->is_zero()) {
-        result->impl_->is_negative_ = true;
+    if (lhs.is_negative() && !result->is_zero()) {
+        detail::big_int_access::impl(*result).is_negative_ = true;
     }
 
-    return *result;
+    return result;
+}
+
+// Applies big_int's sign rules to a division of magnitudes: the quotient is negative when the signs
+// differ, and the remainder takes the sign of the dividend
+std::pair<big_int, big_int> signed_division(
+  DivisionResult &&result,
+  const bool       dividend_negative,
+  const bool       divisor_negative
+) noexcept {
+    if (dividend_negative != divisor_negative && !result.quotient.is_zero()) {
+        detail::big_int_access::impl(result.quotient).is_negative_ = true;
+    }
+    if (dividend_negative && !result.remainder.is_zero()) {
+        detail::big_int_access::impl(result.remainder).is_negative_ = true;
+    }
+    return {std::move(result.quotient), std::move(result.remainder)};
+}
+
+// Unwraps the result of a division, throwing std::domain_error on division by zero
+big_int value_or_domain_error(std::expected<big_int, errors::ArithmeticError> &&result) {
+    if (!result) {
+        throw std::domain_error(std::string(errors::to_string(result.error())));
+    }
+    return std::move(*result);
+}
+
+} // namespace
+
+big_int big_int::add(const big_int &other) const noexcept { return add_signed(*this, other, other.is_negative()); }
+
+big_int big_int::sub(const big_int &other) const noexcept {
+    return add_signed(*this, other, !other.is_negative() && !other.is_zero());
+}
+
+big_int big_int::mul(const big_int &other) const noexcept { return mul_signed(*this, other); }
+
+big_int big_int::square() const noexcept {
+    if (is_zero()) {
+        return big_int();
+    }
+
+    return detail::sqr_abs(*this);
+}
+
+big_int big_int::add_small_impl(const bool negative, const std::uint64_t magnitude) const noexcept {
+    const small_limbs small(magnitude);
+    const auto        limbs = detail::big_int_access::limb_span(*this);
+
+    if (small.size == 0) {
+        return *this;
+    }
+    if (is_zero()) {
+        return detail::big_int_access::create(negative, small.to_vector());
+    }
+
+    if (impl().is_negative_ == negative) {
+        const auto [longer, shorter] = limbs.size() >= small.size ? std::pair{limbs, small.span()}
+                                                                  : std::pair{small.span(), limbs};
+        detail::limb_vector result(longer.size() + 1);
+        result[longer.size()] = detail::add_limbs(result, longer, shorter);
+        return detail::big_int_access::create(negative, std::move(result));
+    }
+
+    // different signs: the larger magnitude keeps its sign
+    if (detail::cmp_limbs(limbs, small.span()) >= 0) {
+        detail::limb_vector result(limbs.size());
+        (void)detail::sub_limbs(result, limbs, small.span());
+        return detail::big_int_access::create(impl().is_negative_, std::move(result));
+    }
+
+    detail::limb_vector result(small.size);
+    (void)detail::sub_limbs(result, small.span(), limbs);
+    return detail::big_int_access::create(negative, std::move(result));
+}
+
+big_int big_int::mul_small_impl(const bool negative, const std::uint64_t magnitude) const noexcept {
+    const small_limbs small(magnitude);
+    if (small.size == 0 || is_zero()) {
+        return big_int();
+    }
+
+    const auto          limbs = detail::big_int_access::limb_span(*this);
+    detail::limb_vector result(limbs.size() + small.size);
+    if (small.size == 1) {
+        result[limbs.size()] = detail::mul_limb(result, limbs, small.data[0]);
+    } else {
+        detail::mul_basecase(result, limbs, small.span());
+    }
+    return detail::big_int_access::create(impl().is_negative_ != negative, std::move(result));
+}
+
+big_int &big_int::add_small_assign(const bool negative, const std::uint64_t magnitude) noexcept {
+    const small_limbs small(magnitude);
+    if (small.size != 0) {
+        add_in_place(impl(), negative, small.span());
+    }
+    return *this;
+}
+
+big_int &big_int::mul_small_assign(const bool negative, const std::uint64_t magnitude) noexcept {
+    const small_limbs small(magnitude);
+    if (small.size != 1) {
+        // zero, or a factor spanning two 32-bit limbs
+        *this = mul_small_impl(negative, magnitude);
+        return *this;
+    }
+
+    auto                &self  = impl();
+    const detail::limb_t carry = detail::mul_limb(self.limbs_, self.limbs_, small.data[0]);
+    if (carry != 0) {
+        self.limbs_.push_back(carry);
+        ++self.length_;
+    }
+    self.is_negative_ = self.is_negative_ != negative;
+    self.normalize();
+    return *this;
+}
+
+std::expected<std::pair<big_int, big_int>, errors::ArithmeticError> big_int::divmod_small_impl(
+  const bool          negative,
+  const std::uint64_t magnitude
+) const noexcept {
+    const small_limbs small(magnitude);
+    if (small.size == 0) {
+        return std::unexpected(errors::ArithmeticError::DivisionByZero);
+    }
+
+    // a 64-bit divisor spans two 32-bit limbs; that case takes the general path
+    if (small.size > 1) {
+        return div_mod(detail::big_int_access::create(negative, small.to_vector()));
+    }
+
+    const auto           limbs = detail::big_int_access::limb_span(*this);
+    detail::limb_vector  quotient(limbs.size());
+    const detail::limb_t remainder = detail::divmod_limb(quotient, limbs, small.data[0]);
+
+    return std::pair{
+      detail::big_int_access::create(impl().is_negative_ != negative, std::move(quotient)),
+      detail::big_int_access::create(impl().is_negative_, {remainder}),
+    };
+}
+
+std::expected<big_int, errors::ArithmeticError> big_int::mod_small_impl(const std::uint64_t magnitude) const noexcept {
+    const small_limbs small(magnitude);
+    if (small.size == 0) {
+        return std::unexpected(errors::ArithmeticError::DivisionByZero);
+    }
+
+    // a 64-bit divisor spans two 32-bit limbs; that case takes the general path
+    if (small.size > 1) {
+        return mod_signed(*this, detail::big_int_access::create(false, small.to_vector()));
+    }
+
+    const detail::limb_t remainder = detail::mod_limb(detail::big_int_access::limb_span(*this), small.data[0]);
+    return detail::big_int_access::create(impl().is_negative_, {remainder});
+}
+
+big_int big_int::value_or_throw(std::expected<big_int, errors::ArithmeticError> &&result) {
+    return value_or_domain_error(std::move(result));
+}
+
+std::expected<big_int, errors::ArithmeticError> big_int::div(const big_int &other) const noexcept {
+    return div_signed(*this, other);
+}
+
+std::expected<big_int, errors::ArithmeticError> big_int::mod(const big_int &other) const noexcept {
+    return mod_signed(*this, other);
 }
 
 std::expected<std::pair<big_int, big_int>, errors::ArithmeticError> big_int::div_mod(
@@ -317,45 +769,129 @@ std::expected<std::pair<big_int, big_int>, errors::ArithmeticError> big_int::div
     }
 
     // Apply sign rules
-    const bool quotient_negative = impl_->is_negative_ != other.impl_->is_negative_;
+    const bool quotient_negative = impl().is_negative_ != other.impl().is_negative_;
     if (quotient_negative && !result->quotient.is_zero()) {
-        result->quotient.impl_->is_negative_ = true;
+        result->quotient.impl().is_negative_ = true;
     }
 
     // Remainder has same sign as dividend
-    if (impl_->is_negative_ && !result->remainder.is_zero()) {
-        result->remainder.impl_->is_negative_ = true;
+    if (impl().is_negative_ && !result->remainder.is_zero()) {
+        result->remainder.impl().is_negative_ = true;
     }
 
     return std::pair{std::move(result->quotient), std::move(result->remainder)};
 }
 
-big_int big_int::operator/(const big_int &other) const {
-    auto result = div(other);
-    if (!result) {
-        throw std::domain_error(std::string(errors::to_string(result.error())));
+std::expected<big_int, errors::ArithmeticError> big_int::divexact(const big_int &other) const noexcept {
+    if (other.is_zero()) {
+        return std::unexpected(errors::ArithmeticError::DivisionByZero);
+    }
+
+    big_int quotient = detail::divexact_abs(*this, other);
+    if (impl().is_negative_ != other.impl().is_negative_ && !quotient.is_zero()) {
+        quotient.impl().is_negative_ = true;
     }
-    return *result;
+    return quotient;
 }
 
-big_int big_int::operator%(const big_int &other) const {
-    auto result = mod(other);
-    if (!result) {
-        throw std::domain_error(std::string(errors::to_string(result.error())));
+std::expected<big_int, errors::ArithmeticError> big_int::reciprocal(const std::size_t precision) const noexcept {
+    if (is_zero()) {
+        return std::unexpected(errors::ArithmeticError::DivisionByZero);
+    }
+
+    big_int result = detail::reciprocal_bits(*this, precision);
+    if (impl().is_negative_ && !result.is_zero()) {
+        result.impl().is_negative_ = true;
     }
-    return *result;
+    return result;
+}
+
+big_int big_int::operator/(const big_int &other) const {
+    return value_or_domain_error(div(other));
 }
 
-big_int &big_int::operator/=(const big_int &other) {
-    *this = *this / other; // Uses throwing operator
+big_int big_int::operator%(const big_int &other) const {
+    return value_or_domain_error(mod(other));
+}
+
+big_int &big_int::operator/=(const big_int_view other) {
+    *this = value_or_throw(div_signed(*this, other));
     return *this;
 }
 
-big_int &big_int::operator%=(const big_int &other) {
-    *this = *this % other; // Uses throwing operator
+big_int &big_int::operator%=(const big_int_view other) {
+    *this = value_or_throw(mod_signed(*this, other));
     return *this;
 }
 
+big_int::divisor::divisor(const big_int_view value) : value_(value) {
+    if (value.is_zero()) {
+        throw std::domain_error(std::string(errors::to_string(errors::ArithmeticError::DivisionByZero)));
+    }
+
+    const auto limbs = value.limbs();
+    shift_           = static_cast<unsigned>(std::countl_zero(limbs.back()));
+
+    // the zero limbs below make it the recursive division's padded divisor as well, so that is not
+    // rebuilt per call
+    const size_t        padding = detail::recursive_block_size(limbs.size()) - limbs.size();
+    detail::limb_vector padded(padding + limbs.size());
+    detail::limb_t      carry = 0;
+    for (size_t i = 0; i < limbs.size(); ++i) {
+        padded[padding + i] = (limbs[i] << shift_) | carry;
+        carry               = shift_ == 0 ? 0 : limbs[i] >> (detail::LIMB_BITS - shift_);
+    }
+    reciprocal_ = detail::prepare_limb_divisor(padded.back()).reciprocal;
+    normalized_ = detail::big_int_access::create_abs(std::move(padded));
+}
+
+std::pair<big_int, big_int> big_int::divisor::div_mod(const big_int_view dividend) const {
+    const auto                     padded     = detail::big_int_access::limb_span(normalized_);
+    const auto                     normalized = padded.last(value_.limbs().size());
+    const detail::prepared_divisor prepared{normalized, {normalized.back(), reciprocal_, shift_}, padded};
+
+    return signed_division(detail::div_mod_prepared(dividend, prepared), dividend.is_negative(), value_.is_negative());
+}
+
+big_int big_int::divisor::div(const big_int_view dividend) const { return div_mod(dividend).first; }
+
+big_int big_int::divisor::mod(const big_int_view dividend) const { return div_mod(dividend).second; }
+
+big_int operator/(const big_int_view dividend, const big_int::divisor &divisor) { return divisor.div(dividend); }
+
+big_int operator%(const big_int_view dividend, const big_int::divisor &divisor) { return divisor.mod(dividend); }
+
+barrett_reducer::barrett_reducer(const big_int_view modulus) : modulus_(modulus) {
+    if (modulus.is_zero()) {
+        throw std::domain_error(std::string(errors::to_string(errors::ArithmeticError::DivisionByZero)));
+    }
+    // short moduli divide directly and need no reciprocal
+    if (modulus.limbs().size() >= detail::barrett_threshold) {
+        reciprocal_ = detail::reciprocal_abs(modulus.abs());
+    }
+}
+
+big_int barrett_reducer::reduce(const big_int_view x) const {
+    if (reciprocal_.is_zero()) {
+        return *mod_signed(x, modulus_);
+    }
+
+    big_int remainder = detail::mod_newton(x, modulus_, reciprocal_);
+    if (x.is_negative() && !remainder.is_zero()) {
+        detail::big_int_access::impl(remainder).is_negative_ = true;
+    }
+    return remainder;
+}
+
+std::pair<big_int, big_int> barrett_reducer::div_mod(const big_int_view x) const {
+    if (reciprocal_.is_zero()) {
+        return signed_division(std::move(*detail::div_mod_abs(x, modulus_)), x.is_negative(), modulus_.is_negative());
+    }
+    return signed_division(detail::div_mod_newton(x, modulus_, reciprocal_), x.is_negative(), modulus_.is_negative());
+}
+
+big_int barrett_reducer::mul_mod(const big_int_view lhs, const big_int_view rhs) const { return reduce(lhs * rhs); }
+
 big_int::operator bool() const noexcept { return !is_zero(); }
 
 std::ostream &operator<<(std::ostream &os, const big_int &bi) {
@@ -380,20 +916,80 @@ std::istream &operator>>(std::istream &is, big_int &bi) {
 
 big_int big_int::operator+(const big_int &other) const noexcept { return add(other); }
 
-big_int big_int::operator+=(const big_int &other) noexcept {
-    *this = *this + other;
+big_int &big_int::operator+=(const big_int_view other) noexcept {
+    add_in_place(impl(), other.is_negative(), other.limbs());
     return *this;
 }
 
 big_int big_int::operator-(const big_int &other) const noexcept { return sub(other); }
 
-big_int big_int::operator-=(const big_int &other) noexcept {
-    *this = *this - other;
+big_int &big_int::operator-=(const big_int_view other) noexcept {
+    add_in_place(impl(), !other.is_negative(), other.limbs());
     return *this;
 }
 
 big_int big_int::operator*(const big_int &other) const noexcept { return mul(other); }
 
-big_int big_int::operator-() const noexcept { return negate(); }
+big_int &big_int::operator*=(const big_int_view other) noexcept {
+    *this = mul_signed(*this, other);
+    return *this;
+}
+
+big_int operator+(big_int &&lhs, const big_int &rhs) noexcept {
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+big_int operator+(const big_int &lhs, big_int &&rhs) noexcept {
+    rhs += lhs;
+    return std::move(rhs);
+}
+
+big_int operator+(big_int &&lhs, big_int &&rhs) noexcept {
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+big_int operator-(big_int &&lhs, const big_int &rhs) noexcept {
+    lhs -= rhs;
+    return std::move(lhs);
+}
+
+big_int operator-(const big_int &lhs, big_int &&rhs) noexcept {
+    // lhs - rhs = -(rhs - lhs)
+    rhs -= lhs;
+    rhs.impl().is_negative_ = !rhs.impl().is_negative_ && !rhs.is_zero();
+    return std::move(rhs);
+}
+
+big_int operator-(big_int &&lhs, big_int &&rhs) noexcept {
+    lhs -= rhs;
+    return std::move(lhs);
+}
+
+big_int big_int::operator-() const & noexcept { return negate(); }
+
+big_int big_int::operator-() && noexcept {
+    if (!is_zero()) {
+        impl().is_negative_ = !impl().is_negative_;
+    }
+    return std::move(*this);
+}
+
+big_int operator+(const big_int_view lhs, const big_int_view rhs) { return add_signed(lhs, rhs, rhs.is_negative()); }
+
+big_int operator-(const big_int_view lhs, const big_int_view rhs) {
+    return add_signed(lhs, rhs, !rhs.is_negative() && !rhs.is_zero());
+}
+
+big_int operator*(const big_int_view lhs, const big_int_view rhs) { return mul_signed(lhs, rhs); }
+
+big_int operator/(const big_int_view lhs, const big_int_view rhs) {
+    return value_or_domain_error(div_signed(lhs, rhs));
+}
+
+big_int operator%(const big_int_view lhs, const big_int_view rhs) {
+    return value_or_domain_error(mod_signed(lhs, rhs));
+}
 
 } // namespace arbys::bignum
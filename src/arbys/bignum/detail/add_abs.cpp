@@ -1,4 +1,6 @@
 #include <ranges>
+#include <span>
+#include <utility>
 
 #include "arbys/bignum/big_int.h"
 #include "big_int_internal.h"
@@ -6,16 +8,32 @@
 
 namespace arbys::bignum::detail {
 
-big_int add_abs(const big_int &lhs, const big_int &rhs) {
-    const big_int *bigger  = (big_int_access::length(lhs) >= big_int_access::length(rhs)) ? &lhs : &rhs;
-    const big_int *smaller = (bigger == &lhs) ? &rhs : &lhs;
+limb_t add_limbs(std::span<limb_t> out, std::span<const limb_t> lhs, std::span<const limb_t> rhs) noexcept {
+    dlimb_t carry = 0;
+
+    for (size_t i = 0; i < rhs.size(); ++i) {
+        const dlimb_t sum = dlimb_t{lhs[i]} + rhs[i] + carry;
+        out[i]            = static_cast<limb_t>(sum);
+        carry             = sum >> LIMB_BITS;
+    }
+
+    for (size_t i = rhs.size(); i < lhs.size(); ++i) {
+        const dlimb_t sum = dlimb_t{lhs[i]} + carry;
+        out[i]            = static_cast<limb_t>(sum);
+        carry             = sum >> LIMB_BITS;
+    }
+
+    return static_cast<limb_t>(carry);
+}
 
-    const auto  &bigger_limbs  = big_int_access::limbs(*bigger);
-    const auto  &smaller_limbs = big_int_access::limbs(*smaller);
-    const size_t bigger_len    = big_int_access::length(*bigger);
-    const size_t smaller_len   = big_int_access::length(*smaller);
+big_int add_abs(const big_int_view lhs, const big_int_view rhs) {
+    const auto [bigger_limbs, smaller_limbs] = lhs.limbs().size() >= rhs.limbs().size()
+                                                 ? std::pair{lhs.limbs(), rhs.limbs()}
+                                                 : std::pair{rhs.limbs(), lhs.limbs()};
+    const size_t bigger_len  = bigger_limbs.size();
+    const size_t smaller_len = smaller_limbs.size();
 
-    std::vector<limb_t> result_limbs;
+    limb_vector result_limbs;
     result_limbs.reserve(bigger_len + 1); // +1 for possible carry
 
     dlimb_t carry = 0;
@@ -23,8 +41,8 @@ big_int add_abs(const big_int &lhs, const big_int &rhs) {
     // Add overlapping limbs
     for (size_t i = 0; i < smaller_len; ++i) {
         const dlimb_t sum = static_cast<dlimb_t>(bigger_limbs[i]) + smaller_limbs[i] + carry;
-        result_limbs.push_back(static_cast<limb_t>(sum)); // Lower 32 bits
-        carry = sum >> LIMB_BITS;                         // Upper 32 bits (0 or 1)
+        result_limbs.push_back(static_cast<limb_t>(sum)); // Lower limb
+        carry = sum >> LIMB_BITS;                         // Upper limb (0 or 1)
     }
 
     // Copy remaining limbs from bigger number
@@ -1,30 +1,64 @@
 #pragma once
 
+#include "arbys/bignum/big_int.h"
 #include "config.h"
+#include "limb_vector.h"
 
+#include <new>
 #include <ranges>
+#include <span>
+#include <type_traits>
 #include <vector>
 
 namespace arbys::bignum::detail {
+static_assert(std::is_same_v<limb_t, limb_type>, "the public limb_type must match the limbs of big_int_impl");
+
 struct big_int_impl {
-    bool                is_negative_ = false;
-    std::vector<limb_t> limbs_;      // stored in reverse (LSB first)
-    size_t              length_ = 0; // limb count
+    limb_vector limbs_;           // stored in reverse (LSB first), inline for small values
+    size_t      length_      = 0; // limb count
+    bool        is_negative_ = false;
 
     big_int_impl() : limbs_{0}, length_(1) {}
 
-    big_int_impl(bool negative, std::vector<limb_t> limbs)
-      : is_negative_(negative), limbs_(std::move(limbs)), length_(limbs_.size()) {
+    big_int_impl(bool negative, limb_vector limbs)
+      : limbs_(std::move(limbs)), length_(limbs_.size()), is_negative_(negative) {
         normalize();
     }
 
+    big_int_impl(const big_int_impl &other)            = default;
+    big_int_impl &operator=(const big_int_impl &other) = default;
+
+    // Moved-from values are left as zero so a moved-from big_int stays usable
+    big_int_impl(big_int_impl &&other) noexcept
+      : limbs_(std::move(other.limbs_)), length_(other.length_), is_negative_(other.is_negative_) {
+        other.set_zero();
+    }
+
+    big_int_impl &operator=(big_int_impl &&other) noexcept {
+        if (this != &other) {
+            limbs_       = std::move(other.limbs_);
+            length_      = other.length_;
+            is_negative_ = other.is_negative_;
+            other.set_zero();
+        }
+        return *this;
+    }
+
+    // Reset to canonical zero; never allocates on a moved-from (inline) buffer
+    void set_zero() noexcept {
+        limbs_.clear();
+        limbs_.push_back(0);
+        length_      = 1;
+        is_negative_ = false;
+    }
+
     // Remove leading zeros and handle zero sign
     void normalize() {
         while (length_ > 1 && limbs_[length_ - 1] == 0) {
             length_--;
         }
 
-        // Resize vector to match actual length (save memory)
+        // Resize storage to match actual length
         if (limbs_.size() > length_) {
             limbs_.resize(length_);
         }
@@ -39,63 +73,41 @@ struct big_int_impl {
     [[nodiscard]] limb_t operator[](const std::size_t index) const noexcept { return limbs_[index]; }
 
     [[nodiscard]] limb_t &operator[](const std::size_t index) noexcept { return limbs_[index]; }
-
-    template <class Out> Out write_digits_to(Out out) const {
-        if (length_ == 1 && limbs_[0] == 0) {
-            *out++ = '0';
-            return out;
-        }
-
-        // Copy limbs
-        std::vector<detail::limb_t> temp     = limbs_;
-        std::size_t                 temp_len = length_;
-
-        // Extract digits in reverse (least → most significant)
-        std::vector<char> digits;
-        digits.reserve(temp_len * 10); // log10(2^32) ≈ 9.63
-
-        while (temp_len > 1 || temp[0] > 0) {
-            detail::dlimb_t remainder = 0;
-
-            for (std::size_t i = temp_len; i-- > 0;) {
-                const detail::dlimb_t current = (remainder << detail::LIMB_BITS) | temp[i];
-                temp[i]                       = static_cast<detail::limb_t>(current / 10);
-                remainder                     = current % 10;
-            }
-
-            while (temp_len > 1 && temp[temp_len - 1] == 0)
-                --temp_len;
-
-            digits.push_back(static_cast<char>('0' + remainder));
-        }
-
-        // Emit digits in correct order
-        for (char digit : std::ranges::reverse_view(digits))
-            *out++ = digit;
-
-        return out;
-    }
 };
 
 struct big_int_access {
-    static const std::vector<limb_t> &limbs(const big_int &n) noexcept { return n.impl_->limbs_; }
+    static const limb_vector &limbs(const big_int &n) noexcept { return n.impl().limbs_; }
 
-    static size_t length(const big_int &n) noexcept { return n.impl_->length_; }
+    static std::span<const limb_t> limb_span(const big_int &n) noexcept {
+        return {n.impl().limbs_.data(), n.impl().length_};
+    }
+
+    static size_t length(const big_int &n) noexcept { return n.impl().length_; }
 
-    static bool is_negative(const big_int &n) noexcept { return n.impl_->is_negative_; }
+    static bool is_negative(const big_int &n) noexcept { return n.impl().is_negative_; }
 
     // Write access for creating results
-    static big_int create(bool negative, std::vector<limb_t> limbs) {
-        return big_int(std::make_unique<big_int_impl>(negative, std::move(limbs)));
+    static big_int create(bool negative, limb_vector limbs) {
+        return big_int(big_int_impl(negative, std::move(limbs)));
     }
 
-    static big_int create_abs(std::vector<limb_t> limbs) {
-        return big_int(std::make_unique<big_int_impl>(false, std::move(limbs)));
-    }
+    static big_int create_abs(limb_vector limbs) { return big_int(big_int_impl(false, std::move(limbs))); }
 
     // Direct impl access
-    static big_int_impl &impl(big_int &n) noexcept { return *n.impl_; }
+    static big_int_impl &impl(big_int &n) noexcept { return n.impl(); }
 
-    static const big_int_impl &impl(const big_int &n) noexcept { return *n.impl_; }
+    static const big_int_impl &impl(const big_int &n) noexcept { return n.impl(); }
 };
-} // namespace arbys::bignum::detail
\ No newline at end of file
+} // namespace arbys::bignum::detail
+
+namespace arbys::bignum {
+
+inline detail::big_int_impl &big_int::impl() noexcept {
+    return *std::launder(reinterpret_cast<detail::big_int_impl *>(impl_storage_));
+}
+
+inline const detail::big_int_impl &big_int::impl() const noexcept {
+    return *std::launder(reinterpret_cast<const detail::big_int_impl *>(impl_storage_));
+}
+
+} // namespace arbys::bignum
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include "arbys/bignum/big_int.h"
+#include "big_int_internal.h"
+#include "detail.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <span>
+
+namespace arbys::bignum::detail {
+
+constexpr size_t limb_bytes = sizeof(limb_t);
+
+// Bits of a magnitude stored in limbs; 0 for zero
+[[nodiscard]] static size_t bit_length(std::span<const limb_t> limbs) noexcept {
+    while (!limbs.empty() && limbs.back() == 0) {
+        limbs = limbs.first(limbs.size() - 1);
+    }
+    return limbs.empty() ? 0 : (limbs.size() - 1) * LIMB_BITS + std::bit_width(limbs.back());
+}
+
+// out[0, out.size()) = the low out.size() bytes of limbs, least significant first, zero-filled past them
+static void copy_limb_bytes(std::span<std::byte> out, std::span<const limb_t> limbs) noexcept {
+    const size_t count = std::min(out.size(), limbs.size() * limb_bytes);
+    if constexpr (std::endian::native == std::endian::little) {
+        std::memcpy(out.data(), limbs.data(), count);
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = static_cast<std::byte>(limbs[i / limb_bytes] >> (8 * (i % limb_bytes)));
+        }
+    }
+    std::fill(out.begin() + static_cast<std::ptrdiff_t>(count), out.end(), std::byte{0});
+}
+
+// limbs = the bytes of in, least significant first
+// Precondition: limbs.size() * limb_bytes >= in.size(); limbs zero-filled
+static void copy_bytes_to_limbs(std::span<limb_t> limbs, std::span<const std::byte> in) noexcept {
+    if constexpr (std::endian::native == std::endian::little) {
+        std::memcpy(limbs.data(), in.data(), in.size());
+    } else {
+        for (size_t i = 0; i < in.size(); ++i) {
+            limbs[i / limb_bytes] |= static_cast<limb_t>(in[i]) << (8 * (i % limb_bytes));
+        }
+    }
+}
+
+// Two's complement negation of a little-endian byte string in place: invert, then add one
+static void negate_bytes(std::span<std::byte> bytes) noexcept {
+    bool carry = true;
+    for (std::byte &b : bytes) {
+        b = ~b;
+        if (carry) {
+            b     = static_cast<std::byte>(static_cast<unsigned char>(b) + 1);
+            carry = b == std::byte{0};
+        }
+    }
+}
+
+size_t byte_size(const big_int &x, const byte_encoding encoding) noexcept {
+    const auto limbs = big_int_access::limb_span(x);
+
+    // -2^(8n - 1) still fits in n bytes of two's complement, so a negative value needs room for |x| - 1
+    // plus the sign bit; everything else needs room for |x| plus the sign bit
+    size_t bits = bit_length(limbs);
+    if (x.is_negative() && encoding == byte_encoding::twos_complement && std::has_single_bit(limbs.back())
+        && std::all_of(limbs.begin(), limbs.end() - 1, [](const limb_t limb) { return limb == 0; })) {
+        --bits;
+    }
+    return bits / 8 + 1;
+}
+
+void write_bytes(
+  std::span<std::byte> out,
+  const big_int       &x,
+  const std::endian    order,
+  const byte_encoding  encoding
+) noexcept {
+    copy_limb_bytes(out, big_int_access::limb_span(x));
+
+    if (x.is_negative() && !out.empty()) {
+        if (encoding == byte_encoding::twos_complement) {
+            negate_bytes(out);
+        } else {
+            out.back() |= std::byte{0x80};
+        }
+    }
+
+    if (order == std::endian::big) {
+        std::ranges::reverse(out);
+    }
+}
+
+big_int read_bytes(std::span<const std::byte> in, const std::endian order, const byte_encoding encoding) {
+    if (in.empty()) {
+        return big_int();
+    }
+
+    limb_vector limbs((in.size() + limb_bytes - 1) / limb_bytes, 0);
+    if (order == std::endian::big) {
+        // reverse straight into the limbs rather than through a copy of the input
+        if constexpr (std::endian::native == std::endian::little) {
+            std::ranges::reverse_copy(in, reinterpret_cast<std::byte *>(limbs.data()));
+        } else {
+            for (size_t i = 0; i < in.size(); ++i) {
+                limbs[i / limb_bytes] |= static_cast<limb_t>(in[in.size() - 1 - i]) << (8 * (i % limb_bytes));
+            }
+        }
+    } else {
+        copy_bytes_to_limbs(limbs, in);
+    }
+
+    const size_t top_byte = in.size() - 1;
+    const limb_t sign_bit = limb_t{0x80} << (8 * (top_byte % limb_bytes));
+    const bool   negative = (limbs[top_byte / limb_bytes] & sign_bit) != 0;
+
+    if (negative && encoding == byte_encoding::sign_magnitude) {
+        limbs[top_byte / limb_bytes] &= ~sign_bit;
+    } else if (negative) {
+        // sign-extend the top limb, then |x| = ~raw + 1 over whole limbs
+        if (const size_t used = (top_byte % limb_bytes + 1) * 8; used < LIMB_BITS) {
+            limbs.back() |= static_cast<limb_t>(~limb_t{0}) << used;
+        }
+        limb_t carry = 1;
+        for (limb_t &limb : limbs) {
+            limb  = ~limb + carry;
+            carry = carry != 0 && limb == 0 ? 1 : 0;
+        }
+    }
+    return big_int_access::create(negative, std::move(limbs));
+}
+
+} // namespace arbys::bignum::detail
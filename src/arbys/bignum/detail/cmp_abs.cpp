@@ -1,18 +1,41 @@
+#include <algorithm>
 #include <compare>
+#include <span>
 
 #include "arbys/bignum/big_int.h"
 #include "big_int_internal.h"
+#include "detail.h"
 
 namespace arbys::bignum::detail {
 
-std::strong_ordering cmp_abs(const big_int &lhs, const big_int &rhs) {
-    if (big_int_access::length(lhs) != big_int_access::length(rhs)) {
-        return (big_int_access::length(lhs) < big_int_access::length(rhs)) ? std::strong_ordering::less
-                                                                           : std::strong_ordering::greater;
+std::strong_ordering cmp_limbs(std::span<const limb_t> lhs, std::span<const limb_t> rhs) noexcept {
+    // Limbs past the end of the shorter operand count as zero
+    for (size_t i = lhs.size(); i > rhs.size(); --i) {
+        if (lhs[i - 1] != 0) {
+            return std::strong_ordering::greater;
+        }
     }
+    for (size_t i = rhs.size(); i > lhs.size(); --i) {
+        if (rhs[i - 1] != 0) {
+            return std::strong_ordering::less;
+        }
+    }
+
+    for (size_t i = std::min(lhs.size(), rhs.size()); i-- > 0;) {
+        if (lhs[i] != rhs[i]) {
+            return lhs[i] <=> rhs[i];
+        }
+    }
+    return std::strong_ordering::equal;
+}
+
+std::strong_ordering cmp_abs(const big_int_view lhs, const big_int_view rhs) noexcept {
+    const auto lhs_digits = lhs.limbs();
+    const auto rhs_digits = rhs.limbs();
 
-    const auto &lhs_digits = big_int_access::limbs(lhs);
-    const auto &rhs_digits = big_int_access::limbs(rhs);
+    if (lhs_digits.size() != rhs_digits.size()) {
+        return lhs_digits.size() <=> rhs_digits.size();
+    }
 
     // Compare from MSD (reverse iterators)
     return std::lexicographical_compare_three_way(
@@ -2,12 +2,40 @@
 
 #include <cstdint>
 
+// Limb width, chosen at configure time with -DARBYS_BIGNUM_LIMB_BITS=32|64
+#ifndef ARBYS_BIGNUM_LIMB_BITS
+#define ARBYS_BIGNUM_LIMB_BITS 32
+#endif
+
 namespace arbys::bignum::detail {
 
-using limb_t                        = uint32_t;
-using dlimb_t                       = uint64_t;
-using s_dlimb_t                     = int64_t;
-static constexpr unsigned LIMB_BITS = 32;
-static constexpr dlimb_t  BASE      = dlimb_t{1} << LIMB_BITS;
+#if ARBYS_BIGNUM_LIMB_BITS == 64
+
+#ifndef __SIZEOF_INT128__
+#error "64-bit limbs need a compiler with unsigned __int128"
+#endif
+
+using limb_t = uint64_t;
+__extension__ typedef unsigned __int128 dlimb_t;
+__extension__ typedef __int128          s_dlimb_t;
+
+static constexpr unsigned LIMB_BITS        = 64;
+static constexpr unsigned DEC_CHUNK_DIGITS = 19; // largest power of ten below 2^64
+static constexpr limb_t   DEC_CHUNK_BASE   = 10'000'000'000'000'000'000ULL;
+
+#elif ARBYS_BIGNUM_LIMB_BITS == 32
+
+using limb_t                               = uint32_t;
+using dlimb_t                              = uint64_t;
+using s_dlimb_t                            = int64_t;
+static constexpr unsigned LIMB_BITS        = 32;
+static constexpr unsigned DEC_CHUNK_DIGITS = 9; // largest power of ten below 2^32
+static constexpr limb_t   DEC_CHUNK_BASE   = 1'000'000'000;
+
+#else
+#error "ARBYS_BIGNUM_LIMB_BITS must be 32 or 64"
+#endif
+
+static constexpr dlimb_t BASE = dlimb_t{1} << LIMB_BITS;
 
-} // namespace arbys::bignum::detail
\ No newline at end of file
+} // namespace arbys::bignum::detail
@@ -0,0 +1,37 @@
+#include "arbys/bignum/big_int.h"
+#include "big_int_internal.h"
+#include "detail.h"
+
+#include <deque>
+#include <mutex>
+
+namespace arbys::bignum::detail {
+
+namespace {
+
+// A deque never moves its elements, so references handed out stay valid while the table grows
+std::mutex                table_mutex;
+std::deque<radix_power> table;
+
+} // namespace
+
+const radix_power &decimal_power_at(const size_t k, const bool with_reciprocal) {
+    const std::scoped_lock lock(table_mutex);
+
+    while (table.size() <= k) {
+        if (table.empty()) {
+            table.push_back({big_int_access::create_abs({DEC_CHUNK_BASE}), big_int(), DEC_CHUNK_DIGITS});
+        } else {
+            const radix_power &previous = table.back();
+            table.push_back({previous.value.square(), big_int(), 2 * previous.digits});
+        }
+    }
+
+    radix_power &power = table[k];
+    if (with_reciprocal && power.reciprocal.is_zero()) {
+        power.reciprocal = reciprocal_abs(power.value);
+    }
+    return power;
+}
+
+} // namespace arbys::bignum::detail
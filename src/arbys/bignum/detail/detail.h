@@ -4,9 +4,14 @@
 #include "arbys/bignum/errors.h"
 #include "arbys/bignum/results.h"
 #include "config.h"
+#include "limb_vector.h"
 
+#include <bit>
+#include <cstddef>
 #include <expected>
 #include <locale>
+#include <span>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -27,42 +32,340 @@ namespace arbys::bignum::detail {
         return sv;
     }
 
+    // Decimal digits to limbs: chunked accumulation for short inputs, hi * 10^k + lo recombination
+    // over the cached powers of ten (see decimal_power_at) for long ones
     std::expected<big_int, errors::ParseError>
     parse_limbs(std::string_view input, bool is_negative);
 
+    // Digits in base 2..36, either letter case: bit packing for powers of two, parse_limbs for 10,
+    // chunked accumulation and divide and conquer over powers of the base otherwise
+    std::expected<big_int, errors::ParseError>
+    parse_limbs_base(std::string_view input, bool is_negative, unsigned base);
+
+    // Length of the leading run of characters in input that are digits of base 2..36, letters in either case
+    size_t digit_run(std::string_view input, unsigned base) noexcept;
+
+    // Chunked accumulation only, one pass over the limbs per 16-digit block; quadratic in the input length
     std::expected<big_int, errors::ParseError>
     parse_limbs_optimized(std::string_view input, bool is_negative);
 
-    void trim_leading_zeros(std::vector<limb_t> &limbs);
-    void propagate_carries(std::vector<limb_t> &limbs);
+    // Blocks parse_decimal_parallel cuts the digits into hold DEC_CHUNK_DIGITS << parallel_block_level digits
+    inline constexpr size_t parallel_block_level = 14;
+
+    // Decimal digits to limbs on up to `threads` threads: the digits are cut into equal blocks from the least
+    // significant end, each parsed on its own, and neighbours recombined as hi * 10^k + lo up a balanced tree
+    // over the cached powers of ten. Separators are skipped as from_string(input, separator) does, compacting
+    // one block at a time rather than the whole input
+    std::expected<big_int, errors::ParseError> parse_decimal_parallel(
+      std::string_view input,
+      bool             is_negative,
+      std::string_view separator,
+      unsigned         threads,
+      size_t           block_level = parallel_block_level
+    );
+
+    // Kernels turning blocks of 16 ASCII decimal digits into their values (each below 10^16),
+    // validating the digits in the same pass
+    enum class digit_kernel { scalar, sse41, avx2 };
+
+    // Whether this build and the CPU it runs on can use the kernel
+    bool digit_kernel_supported(digit_kernel kernel) noexcept;
+
+    // values[i] = the 16 digits starting at digits[16 * i], for every i below values.size()
+    // Returns false, leaving values unspecified, if any of those bytes is not a decimal digit
+    // Precondition: digits.size() >= 16 * values.size()
+    // The first overload uses the fastest supported kernel, the second the given one
+    bool parse_digit_blocks(std::string_view digits, std::span<std::uint64_t> values) noexcept;
+    bool parse_digit_blocks(digit_kernel kernel, std::string_view digits, std::span<std::uint64_t> values) noexcept;
+
+    // The operands of the functions below that only read them are big_int_views, so that big_ints and
+    // limbs held elsewhere go through the same code without a copy
+
+    void trim_leading_zeros(limb_vector &limbs);
+    void propagate_carries(limb_vector &limbs);
+
+    std::strong_ordering cmp_abs(big_int_view lhs, big_int_view rhs) noexcept;
+
+    // Compares two limb spans as numbers; the shorter one is treated as zero-extended
+    std::strong_ordering cmp_limbs(std::span<const limb_t> lhs, std::span<const limb_t> rhs) noexcept;
+
+    big_int add_abs(big_int_view lhs, big_int_view rhs);
+
+    // out[0, lhs.size()) = lhs + rhs, returns the carry out
+    // Precondition: lhs.size() >= rhs.size(); out may alias lhs, or rhs at the same offset
+    limb_t add_limbs(std::span<limb_t> out, std::span<const limb_t> lhs, std::span<const limb_t> rhs) noexcept;
+
+    big_int sub_abs(big_int_view lhs, big_int_view rhs);
+
+    // out[0, lhs.size()) = lhs - rhs, returns the borrow out
+    // Precondition: lhs.size() >= rhs.size(); out may alias lhs, or rhs at the same offset
+    limb_t sub_limbs(std::span<limb_t> out, std::span<const limb_t> lhs, std::span<const limb_t> rhs) noexcept;
+
+    // out[0, x.size()) = x * m, returns the carry limb; out may alias x
+    limb_t mul_limb(std::span<limb_t> out, std::span<const limb_t> x, limb_t m) noexcept;
+
+    // Schoolbook product: out[0, lhs.size() + rhs.size()) = lhs * rhs
+    // Precondition: both operands non-empty; out does not overlap either of them
+    void mul_basecase(std::span<limb_t> out, std::span<const limb_t> lhs, std::span<const limb_t> rhs) noexcept;
 
-    std::strong_ordering cmp_abs(const big_int &lhs, const big_int &rhs);
+    // Scratch limbs karatsuba_mul needs when the longer operand has n limbs
+    size_t karatsuba_scratch_size(size_t n) noexcept;
 
-    big_int add_abs(const big_int& lhs, const big_int& rhs);
+    // Karatsuba product: out[0, lhs.size() + rhs.size()) = lhs * rhs, using only the given scratch
+    // Precondition: lhs.size() >= rhs.size() >= 1; scratch.size() >= karatsuba_scratch_size(lhs.size())
+    void karatsuba_mul(
+      std::span<limb_t>       out,
+      std::span<const limb_t> lhs,
+      std::span<const limb_t> rhs,
+      std::span<limb_t>       scratch
+    ) noexcept;
 
-    big_int sub_abs(const big_int& lhs, const big_int& rhs);
+    // Toom-Cook products: out[0, lhs.size() + rhs.size()) = lhs * rhs
+    // Both operands are split into parts of ceil(max size / 3 or 4) limbs; the pointwise products go back
+    // through mul_limbs. Unlike karatsuba_mul these allocate their evaluation buffers per call.
+    // Precondition: both operands non-empty; out does not overlap either of them
+    void toom3_mul(std::span<limb_t> out, std::span<const limb_t> lhs, std::span<const limb_t> rhs);
+    void toom4_mul(std::span<limb_t> out, std::span<const limb_t> lhs, std::span<const limb_t> rhs);
 
-    // Helper to split a BigInt into two halves at position mid
-    std::pair<big_int, big_int> split_at(const big_int &num, std::ptrdiff_t mid);
+    // Toom-Cook squares: out[0, 2 * x.size()) = x * x, evaluating x only once
+    void toom3_sqr(std::span<limb_t> out, std::span<const limb_t> x);
+    void toom4_sqr(std::span<limb_t> out, std::span<const limb_t> x);
 
-    // Shift left by n digits (multiply by base^n)
-    big_int shift_left(const big_int &num, size_t n);
+    // Largest lhs.size() + rhs.size() the three-prime NTT can handle (2^24 32-bit coefficients)
+    inline constexpr size_t ntt_max_limbs = (size_t{1} << 24) / (LIMB_BITS / 32);
+
+    // NTT products: out[0, lhs.size() + rhs.size()) = lhs * rhs in O(n log n) modular operations
+    // Precondition: both operands non-empty; lhs.size() + rhs.size() <= ntt_max_limbs
+    void ntt_mul(std::span<limb_t> out, std::span<const limb_t> lhs, std::span<const limb_t> rhs);
+
+    // NTT square: out[0, 2 * x.size()) = x * x, transforming x only once
+    void ntt_sqr(std::span<limb_t> out, std::span<const limb_t> x);
+
+    // out[0, lhs.size() + rhs.size()) = lhs * rhs, picking the algorithm from the operand sizes
+    // Passing the same span twice forwards to sqr_limbs
+    void mul_limbs(std::span<limb_t> out, std::span<const limb_t> lhs, std::span<const limb_t> rhs);
+
+    // Symmetric schoolbook square: out[0, 2 * x.size()) = x * x, each cross product computed once and doubled
+    // Precondition: x non-empty; out does not overlap x
+    void sqr_basecase(std::span<limb_t> out, std::span<const limb_t> x) noexcept;
+
+    // Scratch limbs karatsuba_sqr needs for an n-limb operand
+    size_t karatsuba_sqr_scratch_size(size_t n) noexcept;
+
+    // Karatsuba square: out[0, 2 * x.size()) = x * x, using only the given scratch
+    // Precondition: x non-empty; scratch.size() >= karatsuba_sqr_scratch_size(x.size())
+    void karatsuba_sqr(std::span<limb_t> out, std::span<const limb_t> x, std::span<limb_t> scratch) noexcept;
+
+    // out[0, 2 * x.size()) = x * x, picking the squaring algorithm from the size of x
+    void sqr_limbs(std::span<limb_t> out, std::span<const limb_t> x);
 
     // Karatsuba multiplication for unsigned BigInts
-    big_int karatsuba_multiply(const big_int &lhs, const big_int &rhs);
+    big_int karatsuba_multiply(big_int_view lhs, big_int_view rhs);
 
     // Simple O(n^2) multiplication for base case
-    big_int simple_multiply(const big_int &lhs, const big_int &rhs);
+    big_int simple_multiply(big_int_view lhs, big_int_view rhs);
+
+    big_int mul_abs(big_int_view lhs, big_int_view rhs);
+
+    big_int sqr_abs(big_int_view x);
+
+    // A limb divisor prepared for division by multiplication (Moller and Granlund, "Improved division by
+    // invariant integers", 2011): a 2-by-1 division costs a limb product and a correction step instead of
+    // a hardware division
+    struct limb_divisor {
+        limb_t   d;          // the divisor shifted left until its top bit is set
+        limb_t   reciprocal; // floor((B^2 - 1) / d) - B
+        unsigned shift;      // bits the divisor was shifted by
+
+        // (u1 B + u0) / d, leaving the remainder in u1
+        // Precondition: u1 < d
+        constexpr limb_t divide(limb_t &u1, const limb_t u0) const noexcept {
+            const dlimb_t q  = dlimb_t{reciprocal} * u1 + ((dlimb_t{u1} << LIMB_BITS) | u0);
+            limb_t        q1 = static_cast<limb_t>(q >> LIMB_BITS) + 1;
+            limb_t        r  = u0 - q1 * d;
+            if (r > static_cast<limb_t>(q)) {
+                --q1;
+                r += d;
+            }
+            if (r >= d) [[unlikely]] {
+                ++q1;
+                r -= d;
+            }
+            u1 = r;
+            return q1;
+        }
+    };
+
+    // Precondition: d != 0
+    constexpr limb_divisor prepare_limb_divisor(const limb_t d) noexcept {
+        const auto   shift      = static_cast<unsigned>(std::countl_zero(d));
+        const limb_t normalized = d << shift;
+        return {normalized, static_cast<limb_t>(~dlimb_t{0} / normalized - BASE), shift};
+    }
+
+    // out[0, x.size()) = x / d, returns x % d; out may alias x
+    // Precondition: d != 0
+    limb_t divmod_limb(std::span<limb_t> out, std::span<const limb_t> x, limb_t d) noexcept;
+
+    // As above with the reciprocal already computed, for a divisor used across many calls
+    limb_t divmod_limb(std::span<limb_t> out, std::span<const limb_t> x, const limb_divisor &d) noexcept;
+
+    // x % d, without writing the quotient limbs divmod_limb would
+    // Precondition: d != 0
+    limb_t mod_limb(std::span<const limb_t> x, limb_t d) noexcept;
 
-    big_int mul_abs(const big_int &lhs, const big_int &rhs);
+    limb_t mod_limb(std::span<const limb_t> x, const limb_divisor &d) noexcept;
+
+    // A divisor prepared once for any number of divisions: its limbs shifted left by top.shift so the top
+    // bit is set, and the top limb of that prepared for the 2-by-1 quotient estimates. padded, when not
+    // empty, is normalized with zero limbs below it up to recursive_block_size, ready for the recursive
+    // division
+    struct prepared_divisor {
+        std::span<const limb_t> normalized;
+        limb_divisor            top;
+        std::span<const limb_t> padded = {};
+    };
+
+    // Quotient and remainder of |dividend| / divisor, skipping the normalization of the divisor
+    DivisionResult div_mod_prepared(big_int_view dividend, const prepared_divisor &divisor);
+
+    // d^-1 mod B for odd d, by Newton iteration: d is its own inverse to 3 bits, and each step doubles that
+    constexpr limb_t inverse_limb(const limb_t d) noexcept {
+        limb_t inverse = d;
+        for (int i = 0; i < 5; ++i) {
+            inverse *= 2 - d * inverse;
+        }
+        return inverse;
+    }
+
+    // out[0, x.size()) = x / d for a d known to divide x, from the low end through inverse_limb: a product
+    // per limb instead of a division. Returns the final borrow, zero when the division is exact
+    // Precondition: d != 0; out may alias x
+    limb_t divexact_limb(std::span<limb_t> out, std::span<const limb_t> x, limb_t d) noexcept;
+
+    // |x| / |d| for a d known to divide x: Hensel division from the low end, which never estimates a
+    // quotient limb or builds a remainder. Debug builds assert that the division is exact
+    // Precondition: d != 0
+    big_int divexact_abs(big_int_view x, big_int_view d);
+
+    [[nodiscard]] std::expected<DivisionResult, errors::ArithmeticError>
+    div_mod_abs(big_int_view dividend, big_int_view divisor) noexcept;
+
+    // Division algorithms div_mod_abs can be held to. automatic picks schoolbook or recursive from the
+    // sizes; newton only pays off once its reciprocal is reused, as barrett_reducer does, so automatic
+    // never picks it
+    enum class division_algorithm { automatic, schoolbook, recursive, newton };
 
     [[nodiscard]] std::expected<DivisionResult, errors::ArithmeticError>
-    div_mod_abs(const big_int& dividend, const big_int& divisor) noexcept;
+    div_mod_abs(big_int_view dividend, big_int_view divisor, division_algorithm algorithm) noexcept;
+
+    // Schoolbook division of |dividend| by |divisor|: a limb at a time for one limb divisors, Knuth's
+    // Algorithm D otherwise
+    // Precondition: divisor != 0
+    DivisionResult div_mod_basecase(big_int_view dividend, big_int_view divisor);
+
+    // Divisors and quotients of at least this many limbs take the recursive division
+    inline constexpr size_t burnikel_ziegler_threshold = 48;
+
+    // Burnikel-Ziegler recursive division of |dividend| by |divisor|: the divisor is padded and normalized
+    // to a block size that halves down to div_mod_basecase, and the dividend is divided a block at a time,
+    // each 2n-by-n step splitting into two 3/2-by-1 steps whose cost is one multiplication of the halves
+    // Precondition: divisor != 0
+    DivisionResult div_mod_recursive(big_int_view dividend, big_int_view divisor);
+
+    // Limbs the recursive division pads an s-limb divisor to
+    size_t recursive_block_size(size_t s) noexcept;
+
+    // The recursive division with the divisor already padded: b is |divisor| << sigma, with
+    // recursive_block_size limbs and its top bit set
+    DivisionResult div_mod_recursive_padded(big_int_view dividend, big_int_view b, size_t sigma);
+
+    // floor(B^2n / d) for an n-limb d, by Newton iteration from the reciprocal of the top half of d
+    // Precondition: d > 0
+    big_int reciprocal_abs(big_int_view d);
+
+    // Barrett division: quotient and remainder of x / d using reciprocal = reciprocal_abs(d)
+    // Precondition: 0 <= x < B^2n for the n-limb d; costs two multiplications instead of a Knuth division
+    DivisionResult div_mod_barrett(big_int_view x, big_int_view d, big_int_view reciprocal);
+
+    // floor(2^bits / |d|) through reciprocal_abs, padding d when bits asks for more than twice its limbs
+    // Precondition: d != 0
+    big_int reciprocal_bits(big_int_view d, size_t bits);
+
+    // Division of |dividend| through the Newton reciprocal of |divisor|: a single div_mod_barrett below
+    // B^2n, otherwise the dividend taken n limbs at a time from the top with one div_mod_barrett per step
+    // Precondition: divisor != 0; reciprocal = reciprocal_abs(divisor) where given
+    DivisionResult div_mod_newton(big_int_view dividend, big_int_view divisor, big_int_view reciprocal);
+    DivisionResult div_mod_newton(big_int_view dividend, big_int_view divisor);
+
+    // Remainders alone of div_mod_barrett and div_mod_newton: no quotient is kept, and x - q d is taken
+    // modulo B^(n + 1) since it is below 3d
+    big_int mod_barrett(big_int_view x, big_int_view d, big_int_view reciprocal);
+    big_int mod_newton(big_int_view dividend, big_int_view divisor, big_int_view reciprocal);
+
+    // Moduli of at least this many limbs reduce by Barrett in barrett_reducer; below it, two full
+    // multiplications cost more than the division they replace
+    inline constexpr size_t barrett_threshold = 50;
+
+    // |x| * 2^bits and |x| / 2^bits
+    big_int shift_bits_left(big_int_view x, size_t bits);
+    big_int shift_bits_right(big_int_view x, size_t bits);
+
+    // Largest power of a base that fits in a limb, and its exponent
+    struct radix_chunk {
+        limb_t value;
+        size_t digits;
+    };
+
+    constexpr radix_chunk chunk_for_base(const unsigned base) noexcept {
+        radix_chunk chunk{1, 0};
+        while (chunk.value <= static_cast<limb_t>(-1) / base) {
+            chunk.value *= base;
+            ++chunk.digits;
+        }
+        return chunk;
+    }
+
+    // base^digits, with its reciprocal for div_mod_barrett once asked for
+    struct radix_power {
+        big_int value;
+        big_int reciprocal;
+        size_t  digits;
+    };
+
+    // 10^(DEC_CHUNK_DIGITS * 2^k), built by repeated squaring on first use and cached for the lifetime
+    // of the program; the reciprocal is only filled in once asked for
+    // Safe to call from several threads; returned references stay valid
+    const radix_power &decimal_power_at(size_t k, bool with_reciprocal);
+
+    // Upper bound on the digits of |x| in base 2..36: exact for powers of two, at most one over otherwise
+    size_t digits_bound(big_int_view x, unsigned base) noexcept;
+
+    // Writes the digits of |x| in base 2..36 to [first, last), lowercase: bit extraction for powers of two,
+    // divide and conquer over powers of the base otherwise. Returns one past the last digit, or nullptr if
+    // they do not fit. Only values past the divide-and-conquer threshold allocate.
+    char *write_digits(char *first, char *last, big_int_view x, unsigned base);
+
+    // Appends the digits of |x| in base 2..36 to out, as write_digits
+    void append_digits(std::string &out, big_int_view x, unsigned base);
+
+    // Fewest bytes holding x in the encoding, sign bit included
+    size_t byte_size(const big_int &x, byte_encoding encoding) noexcept;
+
+    // out = x in the encoding and byte order, padded on the most significant side to fill out: a memcpy
+    // of the limbs on little-endian hosts, then a negation pass for negative two's complement
+    // Precondition: out.size() >= byte_size(x, encoding)
+    void write_bytes(std::span<std::byte> out, const big_int &x, std::endian order, byte_encoding encoding) noexcept;
+
+    // The number stored in in, as write_bytes writes it
+    big_int read_bytes(std::span<const std::byte> in, std::endian order, byte_encoding encoding);
 
+    // |dividend| / |divisor| alone: no remainder is unnormalized or allocated
     [[nodiscard]] std::expected<big_int, errors::ArithmeticError>
-    div_abs(const big_int& dividend, const big_int& divisor) noexcept;
+    div_abs(big_int_view dividend, big_int_view divisor) noexcept;
 
+    // |dividend| % |divisor| alone: no quotient limbs are stored
     [[nodiscard]] std::expected<big_int, errors::ArithmeticError>
-    mod_abs(const big_int& dividend, const big_int& divisor) noexcept;
+    mod_abs(big_int_view dividend, big_int_view divisor) noexcept;
 
 } // namespace arbys::bignum::detail
\ No newline at end of file
@@ -5,63 +5,14 @@
 #include "detail.h"
 
 #include <algorithm>
+#include <cassert>
 #include <expected>
+#include <span>
 
 namespace arbys::bignum::detail {
 
-/// Compare absolute values for division algorithm
-[[nodiscard]] static std::strong_ordering cmp_abs_range(
-  const big_int &a,
-  size_t         a_start,
-  size_t         a_len,
-  const big_int &b,
-  size_t         b_len
-) noexcept {
-    if (a_len != b_len) {
-        return a_len <=> b_len;
-    }
-
-    const auto &a_limbs = big_int_access::limbs(a);
-    const auto &b_limbs = big_int_access::limbs(b);
-
-    // Compare from most significant to least significant
-    for (size_t i = a_len; i-- > 0;) {
-        if (const auto cmp = a_limbs[a_start + i] <=> b_limbs[i]; cmp != 0) {
-            return cmp;
-        }
-    }
-    return std::strong_ordering::equal;
-}
-
-/// Subtract b from a[start..start+len] in-place
-/// Precondition: a[start..start+len] >= b
-static void sub_abs_inplace(std::vector<limb_t> &a, const size_t start, const big_int &b, const size_t b_len) noexcept {
-    const auto &b_limbs = big_int_access::limbs(b);
-    dlimb_t     borrow  = 0;
-
-    // Subtract common limbs
-    for (size_t i = 0; i < b_len; ++i) {
-        const dlimb_t a_val = a[start + i];
-        const dlimb_t b_val = b_limbs[i];
-        const dlimb_t diff  = a_val - b_val - borrow;
-
-        a[start + i] = static_cast<limb_t>(diff);
-        borrow       = (diff > a_val) ? 1 : 0; // Underflow detection
-    }
-
-    // Propagate borrow through remaining limbs
-    for (size_t i = b_len; borrow && (start + i < a.size()); ++i) {
-        if (a[start + i] == 0) {
-            a[start + i] = ~limb_t{0}; // 0xFFFFFFFF
-        } else {
-            a[start + i]--;
-            borrow = 0;
-        }
-    }
-}
-
 /// Normalize a number by shifting left until leading limb >= BASE/2
-/// Returns the shift amount (0-31 bits)
+/// Returns the shift amount (0 to LIMB_BITS - 1 bits)
 [[nodiscard]] static unsigned calculate_normalization_shift(const limb_t leading_limb) noexcept {
     if (leading_limb == 0)
         return 0;
@@ -78,7 +29,7 @@ static void sub_abs_inplace(std::vector<limb_t> &a, const size_t start, const bi
 }
 
 /// Shift vector left by 'shift' bits, returns carry
-[[nodiscard]] static limb_t shift_left(std::vector<limb_t> &vec, const size_t len, const unsigned shift) noexcept {
+[[nodiscard]] static limb_t shift_left(limb_vector &vec, const size_t len, const unsigned shift) noexcept {
     if (shift == 0)
         return 0;
 
@@ -92,7 +43,7 @@ static void sub_abs_inplace(std::vector<limb_t> &a, const size_t start, const bi
 }
 
 /// Shift vector right by 'shift' bits
-static void shift_right(std::vector<limb_t> &vec, const size_t len, const unsigned shift) noexcept {
+static void shift_right(limb_vector &vec, const size_t len, const unsigned shift) noexcept {
     if (shift == 0)
         return;
 
@@ -104,74 +55,135 @@ static void shift_right(std::vector<limb_t> &vec, const size_t len, const unsign
     }
 }
 
-[[nodiscard]] static std::expected<DivisionResult, errors::ArithmeticError> div_single_limb(
-  const big_int &dividend,
-  const limb_t   divisor
-) noexcept {
-    const size_t m              = big_int_access::length(dividend);
-    const auto  &dividend_limbs = big_int_access::limbs(dividend);
+limb_t divmod_limb(std::span<limb_t> out, std::span<const limb_t> x, const limb_t d) noexcept {
+    // one hardware division is cheaper than computing the reciprocal
+    if (x.size() < 2) {
+        dlimb_t remainder = 0;
+        for (size_t i = x.size(); i-- > 0;) {
+            const dlimb_t current = (remainder << LIMB_BITS) | x[i];
+            out[i]                = static_cast<limb_t>(current / d);
+            remainder             = current % d;
+        }
+        return static_cast<limb_t>(remainder);
+    }
+    return divmod_limb(out, x, prepare_limb_divisor(d));
+}
 
-    std::vector<limb_t> quotient(m);
-    dlimb_t             remainder = 0;
+limb_t divmod_limb(std::span<limb_t> out, std::span<const limb_t> x, const limb_divisor &d) noexcept {
+    if (x.empty()) {
+        return 0;
+    }
 
-    // Divide from most significant to least significant
-    for (size_t i = m; i-- > 0;) {
-        const dlimb_t current = (remainder << LIMB_BITS) | dividend_limbs[i];
-        quotient[i]           = static_cast<limb_t>(current / divisor);
-        remainder             = current % divisor;
+    const unsigned shift = d.shift;
+    limb_t         r     = 0;
+    if (shift == 0) {
+        for (size_t i = x.size(); i-- > 0;) {
+            out[i] = d.divide(r, x[i]);
+        }
+        return r;
     }
 
-    big_int q = big_int_access::create(false, std::move(quotient));
-    big_int r = big_int::from_integer(static_cast<limb_t>(remainder));
+    // divide x << shift by the shifted divisor, shifting each limb in as it is read; the quotient is the
+    // same and the remainder comes out shifted
+    r = x.back() >> (LIMB_BITS - shift);
+    for (size_t i = x.size(); i-- > 0;) {
+        const limb_t low = i > 0 ? x[i - 1] >> (LIMB_BITS - shift) : 0;
+        out[i]           = d.divide(r, (x[i] << shift) | low);
+    }
+    return r >> shift;
+}
 
-    return DivisionResult{std::move(q), std::move(r)};
+limb_t mod_limb(std::span<const limb_t> x, const limb_t d) noexcept {
+    if (x.size() < 2) {
+        return x.empty() ? 0 : x[0] % d;
+    }
+    return mod_limb(x, prepare_limb_divisor(d));
 }
 
-// Knuth's Algorithm D
-[[nodiscard]] static std::expected<DivisionResult, errors::ArithmeticError> div_multi_limb(
-  const big_int &dividend,
-  const big_int &divisor
+limb_t mod_limb(std::span<const limb_t> x, const limb_divisor &d) noexcept {
+    if (x.empty()) {
+        return 0;
+    }
+
+    // as divmod_limb, with every quotient limb dropped as soon as it is estimated
+    const unsigned shift = d.shift;
+    limb_t         r     = 0;
+    if (shift == 0) {
+        for (size_t i = x.size(); i-- > 0;) {
+            (void)d.divide(r, x[i]);
+        }
+        return r;
+    }
+
+    r = x.back() >> (LIMB_BITS - shift);
+    for (size_t i = x.size(); i-- > 0;) {
+        const limb_t low = i > 0 ? x[i - 1] >> (LIMB_BITS - shift) : 0;
+        (void)d.divide(r, (x[i] << shift) | low);
+    }
+    return r >> shift;
+}
+
+// The halves of a division a caller reads; the kernels skip building the other one
+enum class division_output { both, quotient, remainder };
+
+[[nodiscard]] static std::expected<DivisionResult, errors::ArithmeticError> div_single_limb(
+  const big_int_view dividend,
+  const limb_t       divisor
 ) noexcept {
-    const size_t m = big_int_access::length(dividend);
-    const size_t n = big_int_access::length(divisor);
+    const auto dividend_limbs = dividend.limbs();
 
-    const auto &dividend_limbs = big_int_access::limbs(dividend);
-    const auto &divisor_limbs  = big_int_access::limbs(divisor);
+    limb_vector  quotient(dividend_limbs.size());
+    const limb_t remainder = divmod_limb(quotient, dividend_limbs, divisor);
 
-    // D1: Normalize - shift divisor so leading limb >= BASE/2
-    const unsigned shift = calculate_normalization_shift(divisor_limbs[n - 1]);
+    big_int q = big_int_access::create(false, std::move(quotient));
+    big_int r = big_int_access::create(false, {remainder});
 
-    // Allocate normalized operands
-    std::vector<limb_t> u(m + 1, 0); // Normalized dividend (extra limb for overflow)
-    std::vector<limb_t> v(n, 0);     // Normalized divisor
+    return DivisionResult{std::move(q), std::move(r)};
+}
 
-    // Normalize dividend
+// Knuth's Algorithm D, from D2 on: the divisor is already normalized
+// Precondition: dividend.size() >= divisor.normalized.size() >= 2; the half output leaves out is zero
+[[nodiscard]] static DivisionResult knuth_divide(
+  const std::span<const limb_t> dividend_limbs,
+  const prepared_divisor       &divisor,
+  const division_output         output = division_output::both
+) {
+    const std::span<const limb_t> v = divisor.normalized;
+
+    const size_t   m     = dividend_limbs.size();
+    const size_t   n     = v.size();
+    const unsigned shift = divisor.top.shift;
+
+    // Normalize dividend (extra limb for overflow)
+    limb_vector u(m + 1, 0);
     std::ranges::copy_n(dividend_limbs.begin(), m, u.begin());
     u[m] = shift_left(u, m, shift);
 
-    // Normalize divisor
-    std::ranges::copy_n(divisor_limbs.begin(), n, v.begin());
-    shift_left(v, n, shift);
-
-    // Allocate quotient
-    std::vector<limb_t> q(m - n + 1, 0);
+    // Allocate quotient, unless only the remainder is wanted
+    const bool  keep_quotient = output != division_output::remainder;
+    limb_vector q(keep_quotient ? m - n + 1 : 0, 0);
 
     const limb_t v1 = v[n - 1];
-    const limb_t v2 = (n > 1) ? v[n - 2] : 0;
+    const limb_t v2 = v[n - 2];
 
     // D2-D7: Main division loop
     for (size_t j = m - n + 1; j-- > 0;) {
-        // D3: Calculate trial quotient digit
-        const dlimb_t u_high = (dlimb_t{u[j + n]} << LIMB_BITS) | u[j + n - 1];
-        dlimb_t       qhat   = u_high / v1;
-        dlimb_t       rhat   = u_high % v1;
+        // D3: Calculate trial quotient digit; u[j + n] <= v1 always, and equality caps qhat at B - 1
+        dlimb_t qhat;
+        dlimb_t rhat;
+        if (u[j + n] >= v1) {
+            qhat = BASE - 1;
+            rhat = dlimb_t{u[j + n - 1]} + v1;
+        } else {
+            limb_t r = u[j + n];
+            qhat     = divisor.top.divide(r, u[j + n - 1]);
+            rhat     = r;
+        }
 
         // Refine qhat to ensure it doesn't overshoot
-        while (qhat >= BASE || (qhat * v2 > (rhat << LIMB_BITS) + u[j + n - 2])) {
+        while (rhat < BASE && qhat * v2 > (rhat << LIMB_BITS) + u[j + n - 2]) {
             qhat--;
             rhat += v1;
-            if (rhat >= BASE)
-                break;
         }
 
         // D4: Multiply and subtract (qhat * divisor from dividend)
@@ -191,12 +203,14 @@ static void shift_right(std::vector<limb_t> &vec, const size_t len, const unsign
         const dlimb_t final_diff = dlimb_t{u[j + n]} - carry - borrow;
         u[j + n]                 = static_cast<limb_t>(final_diff);
 
-        // D5: Test remainder - store quotient digit
-        q[j] = static_cast<limb_t>(qhat);
+        // D5: Test remainder - store quotient digit, one less if D6 has to add back
+        const bool overshot = (final_diff >> LIMB_BITS) & 1;
+        if (keep_quotient) {
+            q[j] = static_cast<limb_t>(qhat) - (overshot ? 1 : 0);
+        }
 
         // D6: Add back if we overshot (negative result)
-        if ((final_diff >> LIMB_BITS) & 1) {
-            q[j]--;
+        if (overshot) {
             dlimb_t carry_back = 0;
             for (size_t i = 0; i < n; ++i) {
                 const dlimb_t sum = dlimb_t{u[j + i]} + v[i] + carry_back;
@@ -207,15 +221,67 @@ static void shift_right(std::vector<limb_t> &vec, const size_t len, const unsign
         }
     }
 
-    // D8: Unnormalize remainder
-    u.resize(n);
-    shift_right(u, n, shift);
+    DivisionResult result;
+    if (keep_quotient) {
+        result.quotient = big_int_access::create(false, std::move(q));
+    }
+    if (output != division_output::quotient) {
+        // D8: Unnormalize remainder
+        u.resize(n);
+        shift_right(u, n, shift);
+        result.remainder = big_int_access::create(false, std::move(u));
+    }
+    return result;
+}
 
-    // Build results
-    big_int quotient  = big_int_access::create(false, std::move(q));
-    big_int remainder = big_int_access::create(false, std::move(u));
+// Knuth's Algorithm D
+[[nodiscard]] static std::expected<DivisionResult, errors::ArithmeticError> div_multi_limb(
+  const big_int_view    dividend,
+  const big_int_view    divisor,
+  const division_output output = division_output::both
+) noexcept {
+    const auto   divisor_limbs = divisor.limbs();
+    const size_t n             = divisor_limbs.size();
 
-    return DivisionResult{std::move(quotient), std::move(remainder)};
+    // D1: Normalize - shift divisor so leading limb >= BASE/2
+    const unsigned shift = calculate_normalization_shift(divisor_limbs[n - 1]);
+
+    limb_vector v(n, 0);
+    std::ranges::copy_n(divisor_limbs.begin(), n, v.begin());
+    (void)shift_left(v, n, shift);
+
+    limb_divisor top = prepare_limb_divisor(v[n - 1]);
+    top.shift        = shift;
+    return knuth_divide(dividend.limbs(), prepared_divisor{v, top}, output);
+}
+
+DivisionResult div_mod_prepared(const big_int_view dividend, const prepared_divisor &divisor) {
+    const auto   dividend_limbs = dividend.limbs();
+    const size_t n              = divisor.normalized.size();
+
+    if (dividend_limbs.size() < n) {
+        return DivisionResult{big_int(), big_int(dividend.abs())};
+    }
+
+    if (n >= burnikel_ziegler_threshold && dividend_limbs.size() - n >= burnikel_ziegler_threshold) {
+        if (!divisor.padded.empty()) {
+            const size_t sigma = (divisor.padded.size() - n) * LIMB_BITS + divisor.top.shift;
+            return div_mod_recursive_padded(dividend, big_int_view(false, divisor.padded), sigma);
+        }
+
+        // the recursion pads and normalizes the divisor its own way
+        limb_vector d(divisor.normalized.begin(), divisor.normalized.end());
+        shift_right(d, n, divisor.top.shift);
+        return div_mod_recursive(dividend, big_int_access::create_abs(std::move(d)));
+    }
+
+    if (n == 1) {
+        limb_vector  quotient(dividend_limbs.size());
+        const limb_t remainder = divmod_limb(quotient, dividend_limbs, divisor.top);
+        return DivisionResult{big_int_access::create(false, std::move(quotient)), big_int_access::create(false, {remainder})};
+    }
+
+    return knuth_divide(dividend_limbs, divisor);
 }
 
 // ============================================================================
@@ -223,11 +289,19 @@ static void shift_right(std::vector<limb_t> &vec, const size_t len, const unsign
 // ============================================================================
 
 [[nodiscard]] std::expected<DivisionResult, errors::ArithmeticError> div_mod_abs(
-  const big_int &dividend,
-  const big_int &divisor
+  const big_int_view dividend,
+  const big_int_view divisor
 ) noexcept {
-    const size_t m = big_int_access::length(dividend);
-    const size_t n = big_int_access::length(divisor);
+    return div_mod_abs(dividend, divisor, division_algorithm::automatic);
+}
+
+[[nodiscard]] std::expected<DivisionResult, errors::ArithmeticError> div_mod_abs(
+  const big_int_view       dividend,
+  const big_int_view       divisor,
+  const division_algorithm algorithm
+) noexcept {
+    const size_t m = dividend.limbs().size();
+    const size_t n = divisor.limbs().size();
 
     // Check for division by zero
     if (divisor.is_zero()) {
@@ -236,43 +310,289 @@ static void shift_right(std::vector<limb_t> &vec, const size_t len, const unsign
 
     // Early return: dividend < divisor
     if (m < n) {
-        return DivisionResult{big_int(), dividend};
+        return DivisionResult{big_int(), big_int(dividend.abs())};
     }
 
     // Early return: dividend == divisor
-    if (m == n && dividend == divisor) {
+    if (m == n && cmp_abs(dividend, divisor) == 0) {
         return DivisionResult{big_int::from_integer(1), big_int()};
     }
 
+    switch (algorithm) {
+    case division_algorithm::schoolbook:
+        return div_mod_basecase(dividend, divisor);
+    case division_algorithm::recursive:
+        return div_mod_recursive(dividend, divisor);
+    case division_algorithm::newton:
+        return div_mod_newton(dividend, divisor);
+    case division_algorithm::automatic:
+        break;
+    }
+
     // Fast path: single-limb divisor
     if (n == 1) {
-        return div_single_limb(dividend, big_int_access::limbs(divisor)[0]);
+        return div_single_limb(dividend, divisor.limbs()[0]);
+    }
+
+    // Long divisor and long quotient: divide and conquer
+    if (n >= burnikel_ziegler_threshold && m - n >= burnikel_ziegler_threshold) {
+        return div_mod_recursive(dividend, divisor);
     }
 
     // General case: multi-limb division
     return div_multi_limb(dividend, divisor);
 }
 
+DivisionResult div_mod_basecase(const big_int_view dividend, const big_int_view divisor) {
+    if (dividend.limbs().size() < divisor.limbs().size()) {
+        return DivisionResult{big_int(), big_int(dividend.abs())};
+    }
+    if (divisor.limbs().size() == 1) {
+        return std::move(*div_single_limb(dividend, divisor.limbs()[0]));
+    }
+    return std::move(*div_multi_limb(dividend, divisor));
+}
+
+// Below this many limbs a reciprocal is a single Knuth division of B^2n
+constexpr size_t newton_reciprocal_threshold = 64;
+
+// Units the Newton step in reciprocal_abs can leave its result off by in either direction: one from the
+// truncated correction, and a quadratic term that the seed's precision keeps below one
+constexpr int newton_reciprocal_corrections = 2;
+
+// |x| / B^k, truncated, keeping the sign of x
+[[nodiscard]] static big_int shift_limbs_right(const big_int_view x, const size_t k) {
+    const auto limbs = x.limbs();
+    if (k >= limbs.size()) {
+        return big_int();
+    }
+    return big_int_access::create(x.is_negative(), limb_vector(limbs.begin() + k, limbs.end()));
+}
+
+// x * B^k
+[[nodiscard]] static big_int shift_limbs_left(const big_int_view x, const size_t k) {
+    const auto  limbs = x.limbs();
+    limb_vector shifted(k + limbs.size());
+    std::ranges::copy(limbs, shifted.begin() + static_cast<std::ptrdiff_t>(k));
+    return big_int_access::create(x.is_negative(), std::move(shifted));
+}
+
+// |x| * 2^bits
+big_int shift_bits_left(const big_int_view x, const size_t bits) {
+    const auto     limbs = x.limbs();
+    const size_t   whole = bits / LIMB_BITS;
+    const unsigned part  = bits % LIMB_BITS;
+
+    limb_vector shifted(whole + limbs.size() + 1);
+    limb_t      carry = 0;
+    for (size_t i = 0; i < limbs.size(); ++i) {
+        shifted[whole + i] = (limbs[i] << part) | carry;
+        carry              = part == 0 ? 0 : limbs[i] >> (LIMB_BITS - part);
+    }
+    shifted[whole + limbs.size()] = carry;
+    return big_int_access::create(false, std::move(shifted));
+}
+
+// |x| / 2^bits
+big_int shift_bits_right(const big_int_view x, const size_t bits) {
+    const auto     limbs = x.limbs();
+    const size_t   whole = bits / LIMB_BITS;
+    const unsigned part  = bits % LIMB_BITS;
+    if (whole >= limbs.size()) {
+        return big_int();
+    }
+
+    limb_vector shifted(limbs.size() - whole);
+    for (size_t i = 0; i < shifted.size(); ++i) {
+        const limb_t next = whole + i + 1 < limbs.size() ? limbs[whole + i + 1] : 0;
+        shifted[i]        = part == 0 ? limbs[whole + i] : (limbs[whole + i] >> part) | (next << (LIMB_BITS - part));
+    }
+    return big_int_access::create(false, std::move(shifted));
+}
+
+// B^k
+[[nodiscard]] static big_int limb_power(const size_t k) {
+    limb_vector limbs(k + 1);
+    limbs[k] = 1;
+    return big_int_access::create_abs(std::move(limbs));
+}
+
+big_int reciprocal_abs(const big_int_view d) {
+    const size_t  n     = d.limbs().size();
+    const big_int power = limb_power(2 * n);
+
+    if (n <= newton_reciprocal_threshold) {
+        return std::move(div_mod_abs(power, d)->quotient);
+    }
+
+    // start from the reciprocal of the top h limbs; the three limbs past n / 2 keep its relative error
+    // below B^(1 - h), so after one Newton step only a few units are left to correct
+    const size_t h = n / 2 + 3;
+    big_int      x = shift_limbs_left(reciprocal_abs(shift_limbs_right(d, n - h)), n - h);
+
+    // x += x (B^2n - d x) / B^2n; the remainder follows the step without a second n-by-n product
+    big_int       remainder = power - d * x;
+    const big_int step      = shift_limbs_right(x * remainder, 2 * n);
+    x += step;
+    remainder -= d * step;
+
+    // settle the last units: d x <= B^2n < d (x + 1)
+    for (int i = 0; i < newton_reciprocal_corrections && remainder.is_negative(); ++i) {
+        x -= 1;
+        remainder += d;
+    }
+    for (int i = 0; i < newton_reciprocal_corrections && remainder >= d; ++i) {
+        x += 1;
+        remainder -= d;
+    }
+    assert(!remainder.is_negative() && remainder < d && "reciprocal_abs: the Newton step is off by more than its bound");
+    return x;
+}
+
+big_int reciprocal_bits(const big_int_view d, const size_t bits) {
+    // floor(B^(2n + e) / d) = floor(B^(2(n + e)) / (d B^e)), with e padding limbs once the precision asks
+    // for more than the 2n limbs reciprocal_abs gives; nested floors compose, so the shift is exact
+    const size_t n     = d.limbs().size();
+    const size_t limbs = (bits + LIMB_BITS - 1) / LIMB_BITS;
+    const size_t e     = limbs > 2 * n ? limbs - 2 * n : 0;
+    return shift_bits_right(reciprocal_abs(shift_limbs_left(d.abs(), e)), (2 * n + e) * LIMB_BITS - bits);
+}
+
+DivisionResult div_mod_barrett(const big_int_view x, const big_int_view d, const big_int_view reciprocal) {
+    const size_t n = d.limbs().size();
+
+    // the estimate is at most two below the true quotient
+    big_int q = shift_limbs_right(shift_limbs_right(x, n - 1) * reciprocal, n + 1);
+    big_int r = x - q * d;
+    while (r >= d) {
+        r -= d;
+        q += 1;
+    }
+    return DivisionResult{std::move(q), std::move(r)};
+}
+
+DivisionResult div_mod_newton(const big_int_view dividend, const big_int_view divisor, const big_int_view reciprocal) {
+    const size_t n     = divisor.limbs().size();
+    const auto   limbs = dividend.limbs();
+    if (limbs.size() <= 2 * n) {
+        return div_mod_barrett(dividend.abs(), divisor.abs(), reciprocal);
+    }
+
+    // n limbs of the dividend at a time from the top, each step's partial remainder below divisor * B^n
+    const size_t blocks = (limbs.size() + n - 1) / n;
+    limb_vector  quotient(blocks * n);
+    big_int      r;
+    for (size_t i = blocks; i-- > 0;) {
+        const auto  block = limbs.subspan(i * n, std::min(n, limbs.size() - i * n));
+        limb_vector z(n + r.limbs().size());
+        std::ranges::copy(block, z.begin());
+        std::ranges::copy(r.limbs(), z.begin() + static_cast<std::ptrdiff_t>(n));
+
+        auto step = div_mod_barrett(big_int_access::create(false, std::move(z)), divisor.abs(), reciprocal);
+        std::ranges::copy(step.quotient.limbs(), quotient.begin() + static_cast<std::ptrdiff_t>(i * n));
+        r = std::move(step.remainder);
+    }
+    return DivisionResult{big_int_access::create(false, std::move(quotient)), std::move(r)};
+}
+
+big_int mod_barrett(const big_int_view x, const big_int_view d, const big_int_view reciprocal) {
+    const auto    d_limbs = d.limbs();
+    const size_t  n       = d_limbs.size();
+    const big_int q       = shift_limbs_right(shift_limbs_right(x, n - 1) * reciprocal, n + 1);
+
+    // x - q d is below 3d < B^(n + 1), so it is found from the low n + 1 limbs of x and of q d alone
+    const size_t k       = n + 1;
+    const auto   x_limbs = x.limbs();
+    limb_vector  r(k);
+    std::ranges::copy(x_limbs.first(std::min(k, x_limbs.size())), r.begin());
+    if (!q.is_zero()) {
+        const auto  q_limbs = big_int_access::limb_span(q);
+        limb_vector product(q_limbs.size() + n);
+        mul_limbs(product, q_limbs, d_limbs);
+        (void)sub_limbs(r, r, std::span<const limb_t>(product).first(std::min(k, product.size())));
+    }
+    while (cmp_limbs(r, d_limbs) >= 0) {
+        (void)sub_limbs(r, r, d_limbs);
+    }
+    return big_int_access::create(false, std::move(r));
+}
+
+big_int mod_newton(const big_int_view dividend, const big_int_view divisor, const big_int_view reciprocal) {
+    const size_t n     = divisor.limbs().size();
+    const auto   limbs = dividend.limbs();
+    if (limbs.size() <= 2 * n) {
+        return mod_barrett(dividend, divisor, reciprocal);
+    }
+
+    // as div_mod_newton, keeping only the partial remainder between steps
+    big_int r;
+    for (size_t i = (limbs.size() + n - 1) / n; i-- > 0;) {
+        const auto  block = limbs.subspan(i * n, std::min(n, limbs.size() - i * n));
+        limb_vector z(n + r.limbs().size());
+        std::ranges::copy(block, z.begin());
+        std::ranges::copy(r.limbs(), z.begin() + static_cast<std::ptrdiff_t>(n));
+        r = mod_barrett(big_int_access::create(false, std::move(z)), divisor, reciprocal);
+    }
+    return r;
+}
+
+DivisionResult div_mod_newton(const big_int_view dividend, const big_int_view divisor) {
+    return div_mod_newton(dividend, divisor, reciprocal_abs(divisor.abs()));
+}
+
 [[nodiscard]] std::expected<big_int, errors::ArithmeticError> div_abs(
-  const big_int &dividend,
-  const big_int &divisor
+  const big_int_view dividend,
+  const big_int_view divisor
 ) noexcept {
-    auto result = div_mod_abs(dividend, divisor);
-    if (!result) {
-        return std::unexpected(result.error());
+    const size_t m = dividend.limbs().size();
+    const size_t n = divisor.limbs().size();
+
+    if (divisor.is_zero()) {
+        return std::unexpected(errors::ArithmeticError::DivisionByZero);
     }
-    return std::move(result->quotient);
+    if (m < n) {
+        return big_int();
+    }
+
+    // the remainder of a single-limb division is one limb held in a register; nothing to skip
+    if (n == 1) {
+        limb_vector quotient(m);
+        (void)divmod_limb(quotient, dividend.limbs(), divisor.limbs()[0]);
+        return big_int_access::create(false, std::move(quotient));
+    }
+
+    if (n >= burnikel_ziegler_threshold && m - n >= burnikel_ziegler_threshold) {
+        return std::move(div_mod_recursive(dividend, divisor).quotient);
+    }
+
+    // Knuth's loop leaves the remainder in its scratch; only the unnormalizing copy is skipped
+    return std::move(div_multi_limb(dividend, divisor, division_output::quotient)->quotient);
 }
 
 [[nodiscard]] std::expected<big_int, errors::ArithmeticError> mod_abs(
-  const big_int &dividend,
-  const big_int &divisor
+  const big_int_view dividend,
+  const big_int_view divisor
 ) noexcept {
-    auto result = div_mod_abs(dividend, divisor);
-    if (!result) {
-        return std::unexpected(result.error());
+    const size_t m = dividend.limbs().size();
+    const size_t n = divisor.limbs().size();
+
+    if (divisor.is_zero()) {
+        return std::unexpected(errors::ArithmeticError::DivisionByZero);
+    }
+    if (m < n) {
+        return big_int(dividend.abs());
     }
-    return std::move(result->remainder);
+
+    // folds the remainder down the dividend without writing a quotient limb
+    if (n == 1) {
+        return big_int_access::create(false, {mod_limb(dividend.limbs(), divisor.limbs()[0])});
+    }
+
+    if (n >= burnikel_ziegler_threshold && m - n >= burnikel_ziegler_threshold) {
+        return std::move(div_mod_recursive(dividend, divisor).remainder);
+    }
+
+    return std::move(div_multi_limb(dividend, divisor, division_output::remainder)->remainder);
 }
 
 } // namespace arbys::bignumbers::detail
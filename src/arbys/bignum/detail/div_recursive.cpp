@@ -0,0 +1,123 @@
+#include "arbys/bignum/big_int.h"
+#include "big_int_internal.h"
+#include "detail.h"
+
+#include <algorithm>
+#include <bit>
+#include <span>
+
+namespace arbys::bignum::detail {
+
+// Burnikel and Ziegler, "Fast Recursive Division", 1998. Operands are sliced into views of their limbs,
+// so only the partial remainders and quotients are allocated.
+
+// |x| mod B^k
+[[nodiscard]] static big_int_view low_limbs(const big_int_view x, const size_t k) noexcept {
+    const auto limbs = x.limbs();
+    return {false, limbs.first(std::min(k, limbs.size()))};
+}
+
+// |x| / B^k
+[[nodiscard]] static big_int_view high_limbs(const big_int_view x, const size_t k) noexcept {
+    const auto limbs = x.limbs();
+    return {false, limbs.subspan(std::min(k, limbs.size()))};
+}
+
+// limbs [k * n, (k + 1) * n) of |x|
+[[nodiscard]] static big_int_view block(const big_int_view x, const size_t k, const size_t n) noexcept {
+    return low_limbs(high_limbs(x, k * n), n);
+}
+
+// hi * B^k + lo
+// Precondition: 0 <= lo < B^k
+[[nodiscard]] static big_int join(const big_int_view hi, const big_int_view lo, const size_t k) {
+    limb_vector limbs(k + hi.limbs().size());
+    std::ranges::copy(lo.limbs(), limbs.begin());
+    std::ranges::copy(hi.limbs(), limbs.begin() + static_cast<std::ptrdiff_t>(k));
+    return big_int_access::create(false, std::move(limbs));
+}
+
+static DivisionResult div_2n_by_n(big_int_view a, big_int_view b, size_t n);
+
+// [a1 a2 a3] / [b1 b2] with halves of h limbs: the quotient is estimated from a1 a2 / b1 and corrected by
+// at most two, so the step costs one n-by-n division and one h-by-h multiplication
+// Precondition: b has 2h limbs and its top bit set; a < b * B^h
+[[nodiscard]] static DivisionResult div_3h_by_2h(const big_int_view a, const big_int_view b, const size_t h) {
+    const big_int_view b1  = high_limbs(b, h);
+    const big_int_view b2  = low_limbs(b, h);
+    const big_int_view a12 = high_limbs(a, h);
+
+    big_int q;
+    big_int c;
+    if (cmp_abs(high_limbs(a, 2 * h), b1) < 0) {
+        auto estimate = div_2n_by_n(a12, b1, h);
+        q             = std::move(estimate.quotient);
+        c             = std::move(estimate.remainder);
+    } else {
+        // the estimate caps at B^h - 1, leaving a1 a2 - (B^h - 1) b1
+        q = join(big_int(1), big_int(), h) - 1;
+        c = a12 - join(b1, big_int(), h) + b1;
+    }
+
+    big_int r = join(c, low_limbs(a, h), h) - q * b2;
+    while (r.is_negative()) {
+        q -= 1;
+        r += b;
+    }
+    return DivisionResult{std::move(q), std::move(r)};
+}
+
+// a / b for an n-limb b, as two 3/2-by-1 steps on the halves down to the basecase
+// Precondition: b has n limbs and its top bit set; a < b * B^n
+[[nodiscard]] static DivisionResult div_2n_by_n(const big_int_view a, const big_int_view b, const size_t n) {
+    if (n % 2 != 0 || n < burnikel_ziegler_threshold) {
+        return div_mod_basecase(a, b);
+    }
+
+    const size_t h     = n / 2;
+    auto         upper = div_3h_by_2h(high_limbs(a, h), b, h);
+    auto         lower = div_3h_by_2h(join(upper.remainder, low_limbs(a, h), h), b, h);
+    return DivisionResult{join(upper.quotient, lower.quotient, h), std::move(lower.remainder)};
+}
+
+size_t recursive_block_size(const size_t s) noexcept {
+    // the block size n = j * 2^k is the first such size at least s with j below the threshold, so the
+    // halving in div_2n_by_n stays even all the way down
+    size_t k = 0;
+    while ((s >> k) >= burnikel_ziegler_threshold) {
+        ++k;
+    }
+    return ((s + (size_t{1} << k) - 1) >> k) << k;
+}
+
+DivisionResult div_mod_recursive(const big_int_view dividend, const big_int_view divisor) {
+    const size_t s = divisor.limbs().size();
+    const size_t n = recursive_block_size(s);
+
+    // pad the divisor to n limbs with its top bit set; the dividend moves with it
+    const size_t  sigma = (n - s) * LIMB_BITS + static_cast<size_t>(std::countl_zero(divisor.limbs().back()));
+    const big_int b     = shift_bits_left(divisor, sigma);
+    return div_mod_recursive_padded(dividend, b, sigma);
+}
+
+DivisionResult div_mod_recursive_padded(const big_int_view dividend, const big_int_view b, const size_t sigma) {
+    const size_t  n = b.limbs().size();
+    const big_int a = shift_bits_left(dividend, sigma);
+
+    // t blocks of n limbs, the top one below B^n / 2 <= b so the first step meets its precondition
+    const auto   a_limbs = big_int_access::limb_span(a);
+    const size_t a_bits  = a_limbs.size() * LIMB_BITS - static_cast<size_t>(std::countl_zero(a_limbs.back()));
+    const size_t t       = std::max<size_t>(2, (a_bits + 1 + n * LIMB_BITS - 1) / (n * LIMB_BITS));
+
+    limb_vector quotient((t - 1) * n);
+    big_int     z = join(block(a, t - 1, n), block(a, t - 2, n), n);
+    for (size_t i = t - 1; i-- > 0;) {
+        auto step = div_2n_by_n(z, b, n);
+        std::ranges::copy(big_int_access::limb_span(step.quotient), quotient.begin() + static_cast<std::ptrdiff_t>(i * n));
+        z = i > 0 ? join(step.remainder, block(a, i - 1, n), n) : std::move(step.remainder);
+    }
+
+    return DivisionResult{big_int_access::create(false, std::move(quotient)), shift_bits_right(z, sigma)};
+}
+
+} // namespace arbys::bignum::detail
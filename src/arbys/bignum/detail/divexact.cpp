@@ -0,0 +1,115 @@
+#include "arbys/bignum/big_int.h"
+#include "big_int_internal.h"
+#include "detail.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <span>
+
+namespace arbys::bignum::detail {
+
+// Exact division from the low end (Jebelean, "An algorithm for exact division", 1993): when d divides x,
+// each quotient limb is the low limb of what is left times d^-1 mod B, so no quotient is ever estimated
+// or corrected and no remainder is built.
+
+// The Hensel loop costs about q * min(n, q) limb products for a q-limb quotient and an n-limb divisor;
+// past this many the recursive division's quotient is cheaper. A 64-bit limb product costs more, so that
+// width crosses over sooner
+constexpr size_t divexact_recursive_products = LIMB_BITS == 64 ? 120'000 : 200'000;
+
+limb_t divexact_limb(std::span<limb_t> out, std::span<const limb_t> x, limb_t d) noexcept {
+    // the factor of two comes off as a shift of x on the fly; what is left of d is odd and invertible
+    const auto shift = static_cast<unsigned>(std::countr_zero(d));
+    d >>= shift;
+    const limb_t inverse = inverse_limb(d);
+
+    limb_t borrow = 0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        const limb_t next = shift == 0 || i + 1 == x.size() ? 0 : x[i + 1] << (LIMB_BITS - shift);
+        const limb_t limb = (x[i] >> shift) | next;
+        const limb_t s    = limb - borrow;
+        borrow            = limb < borrow;
+        out[i]            = s * inverse;
+        borrow += static_cast<limb_t>((dlimb_t{out[i]} * d) >> LIMB_BITS);
+    }
+    return borrow;
+}
+
+// x / d for odd d dividing x: a quadratic Hensel loop, or the recursive division once the loop would cost
+// more limb products than it
+[[nodiscard]] static big_int divexact_odd(const std::span<const limb_t> u, const std::span<const limb_t> v) {
+    const size_t n = v.size();
+    if (u.size() < n) {
+        return big_int();
+    }
+
+    const size_t q_len = u.size() - n + 1;
+    limb_vector  q(q_len);
+    if (n == 1) {
+        (void)divexact_limb(q, u, v[0]);
+        return big_int_access::create(false, std::move(q));
+    }
+
+    if (n >= burnikel_ziegler_threshold && q_len >= burnikel_ziegler_threshold &&
+        q_len * std::min(n, q_len) >= divexact_recursive_products) {
+        return std::move(div_mod_recursive(big_int_view(false, u), big_int_view(false, v)).quotient);
+    }
+
+    // only the low q_len limbs of x - q d are ever read, so the subtraction stops there
+    limb_vector  r(u.begin(), u.begin() + static_cast<std::ptrdiff_t>(q_len));
+    const limb_t inverse = inverse_limb(v[0]);
+    for (size_t i = 0; i < q_len; ++i) {
+        const limb_t qi = r[i] * inverse;
+        q[i]            = qi;
+
+        dlimb_t      carry  = 0;
+        limb_t       borrow = 0;
+        const size_t len    = std::min(n, q_len - i);
+        for (size_t j = 0; j < len; ++j) {
+            const dlimb_t prod = dlimb_t{qi} * v[j] + carry;
+            carry              = prod >> LIMB_BITS;
+            const limb_t low   = static_cast<limb_t>(prod);
+            const limb_t diff  = r[i + j] - low - borrow;
+            borrow             = (r[i + j] < low) || (r[i + j] - low < borrow);
+            r[i + j]           = diff;
+        }
+
+        // the top limb of qi * v and the borrow run on into the limbs still to be read
+        dlimb_t pending = carry + borrow;
+        for (size_t j = i + len; j < q_len && pending != 0; ++j) {
+            const limb_t low = static_cast<limb_t>(pending);
+            pending          = (pending >> LIMB_BITS) + (r[j] < low ? 1 : 0);
+            r[j] -= low;
+        }
+    }
+    return big_int_access::create(false, std::move(q));
+}
+
+big_int divexact_abs(const big_int_view x, const big_int_view d) {
+    const auto x_limbs = x.limbs();
+    const auto d_limbs = d.limbs();
+
+    big_int quotient;
+    if (d_limbs.size() == 1) {
+        // divexact_limb shifts out the factor of two itself, so x is read where it lies
+        limb_vector q(x_limbs.size());
+        (void)divexact_limb(q, x_limbs, d_limbs[0]);
+        quotient = big_int_access::create(false, std::move(q));
+    } else if (d_limbs[0] % 2 == 1) {
+        quotient = divexact_odd(x_limbs, d_limbs);
+    } else {
+        // strip the factor of two d and x share, leaving an odd divisor
+        const auto   zeros = std::ranges::find_if(d_limbs, [](const limb_t limb) { return limb != 0; }) - d_limbs.begin();
+        const size_t shift = static_cast<size_t>(zeros) * LIMB_BITS + static_cast<size_t>(std::countr_zero(d_limbs[zeros]));
+
+        const big_int divisor  = shift_bits_right(d, shift);
+        const big_int dividend = shift_bits_right(x, shift);
+        quotient = divexact_odd(big_int_access::limb_span(dividend), big_int_access::limb_span(divisor));
+    }
+
+    assert(cmp_abs(mul_abs(quotient, d), x.abs()) == 0 && "divexact: the division is not exact");
+    return quotient;
+}
+
+} // namespace arbys::bignum::detail
@@ -0,0 +1,223 @@
+#pragma once
+
+#include "config.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+namespace arbys::bignum::detail {
+
+/// Limb storage with a small inline buffer (LSB first, like the std::vector it replaces).
+/// Up to `inline_capacity` limbs live inside the object; larger values spill into a std::vector.
+/// Once spilled the buffer stays on the heap, so shrinking and regrowing does not reallocate.
+class limb_vector {
+  public:
+    using value_type             = limb_t;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using reference              = limb_t &;
+    using const_reference        = const limb_t &;
+    using pointer                = limb_t *;
+    using const_pointer          = const limb_t *;
+    using iterator               = limb_t *;
+    using const_iterator         = const limb_t *;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type inline_capacity = 4;
+
+    limb_vector() noexcept = default;
+
+    explicit limb_vector(const size_type count, const limb_t value = 0) { resize(count, value); }
+
+    limb_vector(std::initializer_list<limb_t> init) { assign(init.begin(), init.end()); }
+
+    template <std::forward_iterator It> limb_vector(It first, It last) { assign(first, last); }
+
+    /// Adopts a heap buffer without copying; values that fit inline are copied so the buffer is released
+    explicit limb_vector(std::vector<limb_t> &&heap) {
+        if (heap.size() > inline_capacity) {
+            heap_    = std::move(heap);
+            spilled_ = true;
+        } else {
+            assign(heap.begin(), heap.end());
+        }
+    }
+
+    limb_vector(const limb_vector &other) { assign(other.begin(), other.end()); }
+
+    limb_vector(limb_vector &&other) noexcept { steal(other); }
+
+    limb_vector &operator=(const limb_vector &other) {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    limb_vector &operator=(limb_vector &&other) noexcept {
+        if (this != &other) {
+            heap_.clear();
+            heap_.shrink_to_fit();
+            spilled_ = false;
+            steal(other);
+        }
+        return *this;
+    }
+
+    ~limb_vector() = default;
+
+    [[nodiscard]] size_type size() const noexcept { return spilled_ ? heap_.size() : inline_size_; }
+
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    [[nodiscard]] size_type capacity() const noexcept { return spilled_ ? heap_.capacity() : inline_capacity; }
+
+    /// True once the limbs have moved to the heap
+    [[nodiscard]] bool spilled() const noexcept { return spilled_; }
+
+    [[nodiscard]] limb_t *data() noexcept { return spilled_ ? heap_.data() : inline_; }
+
+    [[nodiscard]] const limb_t *data() const noexcept { return spilled_ ? heap_.data() : inline_; }
+
+    [[nodiscard]] iterator begin() noexcept { return data(); }
+    [[nodiscard]] iterator end() noexcept { return data() + size(); }
+
+    [[nodiscard]] const_iterator begin() const noexcept { return data(); }
+    [[nodiscard]] const_iterator end() const noexcept { return data() + size(); }
+
+    [[nodiscard]] reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    [[nodiscard]] reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+
+    [[nodiscard]] const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    [[nodiscard]] const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    [[nodiscard]] limb_t &operator[](const size_type index) noexcept { return data()[index]; }
+
+    [[nodiscard]] limb_t operator[](const size_type index) const noexcept { return data()[index]; }
+
+    [[nodiscard]] limb_t &front() noexcept { return data()[0]; }
+    [[nodiscard]] limb_t  front() const noexcept { return data()[0]; }
+
+    [[nodiscard]] limb_t &back() noexcept { return data()[size() - 1]; }
+    [[nodiscard]] limb_t  back() const noexcept { return data()[size() - 1]; }
+
+    void reserve(const size_type count) {
+        if (count > capacity()) {
+            spill(count);
+        }
+    }
+
+    void resize(const size_type count, const limb_t value = 0) {
+        if (!spilled_ && count <= inline_capacity) {
+            std::fill(inline_ + std::min<size_type>(inline_size_, count), inline_ + count, value);
+            inline_size_ = static_cast<std::uint32_t>(count);
+            return;
+        }
+        spill(count);
+        heap_.resize(count, value);
+    }
+
+    void push_back(const limb_t value) {
+        if (!spilled_ && inline_size_ < inline_capacity) {
+            inline_[inline_size_++] = value;
+            return;
+        }
+        if (!spilled_) {
+            spill(2 * inline_capacity);
+        }
+        heap_.push_back(value);
+    }
+
+    void emplace_back(const limb_t value) { push_back(value); }
+
+    void pop_back() noexcept {
+        if (spilled_) {
+            heap_.pop_back();
+        } else {
+            --inline_size_;
+        }
+    }
+
+    void clear() noexcept {
+        heap_.clear();
+        inline_size_ = 0;
+    }
+
+    template <std::forward_iterator It> void assign(It first, It last) {
+        const auto count = static_cast<size_type>(std::distance(first, last));
+        if (!spilled_ && count <= inline_capacity) {
+            std::copy(first, last, inline_);
+            inline_size_ = static_cast<std::uint32_t>(count);
+            return;
+        }
+        if (!spilled_) {
+            heap_.reserve(count);
+            spilled_ = true;
+        }
+        heap_.assign(first, last);
+    }
+
+    void assign(const size_type count, const limb_t value) {
+        clear();
+        resize(count, value);
+    }
+
+    /// Moves the limbs out as a std::vector, leaving this container empty
+    [[nodiscard]] std::vector<limb_t> release() {
+        std::vector<limb_t> out;
+        if (spilled_) {
+            out = std::move(heap_);
+            heap_.clear();
+            spilled_ = false;
+        } else {
+            out.assign(inline_, inline_ + inline_size_);
+        }
+        inline_size_ = 0;
+        return out;
+    }
+
+    friend bool operator==(const limb_vector &lhs, const limb_vector &rhs) noexcept {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+  private:
+    limb_t              inline_[inline_capacity]{};
+    std::vector<limb_t> heap_;
+    std::uint32_t       inline_size_ = 0;
+    bool                spilled_     = false;
+
+    /// Moves the inline limbs to the heap, reserving room for at least `count` limbs
+    void spill(const size_type count) {
+        if (spilled_) {
+            heap_.reserve(count);
+            return;
+        }
+        // inline_size_ never exceeds inline_capacity; the min states so for release builds
+        const size_type size = std::min(size_type{inline_size_}, inline_capacity);
+        heap_.reserve(std::max(count, size));
+        heap_.assign(inline_, inline_ + size);
+        inline_size_ = 0;
+        spilled_     = true;
+    }
+
+    /// Takes over other's limbs; other is left empty and inline
+    void steal(limb_vector &other) noexcept {
+        if (other.spilled_) {
+            heap_          = std::move(other.heap_);
+            spilled_       = true;
+            other.spilled_ = false;
+            other.heap_.clear();
+        } else {
+            std::copy(std::begin(other.inline_), std::end(other.inline_), inline_);
+            inline_size_ = other.inline_size_;
+        }
+        other.inline_size_ = 0;
+    }
+};
+
+} // namespace arbys::bignum::detail
@@ -0,0 +1,73 @@
+#include "mapped_file.h"
+
+#include <fstream>
+#include <ios>
+#include <iterator>
+
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+#define ARBYS_BIGNUM_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define ARBYS_BIGNUM_HAS_MMAP 0
+#endif
+
+namespace arbys::bignum::detail {
+
+mapped_file::mapped_file(const std::filesystem::path &path) {
+#if ARBYS_BIGNUM_HAS_MMAP
+    if (const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC); fd >= 0) {
+        struct stat status{};
+        if (::fstat(fd, &status) == 0 && S_ISREG(status.st_mode)) {
+            const auto size = static_cast<std::size_t>(status.st_size);
+            if (size == 0) {
+                // nothing to map; mmap rejects a zero length
+                open_ = true;
+            } else if (void *data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0); data != MAP_FAILED) {
+                // the blocks are parsed in parallel, so ask for all of it rather than sequential readahead
+                (void)::madvise(data, size, MADV_WILLNEED);
+                data_   = static_cast<const char *>(data);
+                size_   = size;
+                open_   = true;
+                mapped_ = true;
+            }
+        }
+        // the mapping keeps the file referenced on its own
+        ::close(fd);
+        if (open_) {
+            return;
+        }
+    }
+#endif
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return;
+    }
+    try {
+        // libstdc++ reports a failed read, such as of a directory, by throwing from the stream buffer
+        buffer_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    } catch (const std::ios_base::failure &) {
+        buffer_.clear();
+        return;
+    }
+    if (in.bad()) {
+        buffer_.clear();
+        return;
+    }
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+    open_ = true;
+}
+
+mapped_file::~mapped_file() {
+#if ARBYS_BIGNUM_HAS_MMAP
+    if (mapped_) {
+        ::munmap(const_cast<char *>(data_), size_);
+    }
+#endif
+}
+
+} // namespace arbys::bignum::detail
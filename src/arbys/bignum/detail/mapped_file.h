@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace arbys::bignum::detail {
+
+/// Read-only contents of a whole file: memory-mapped where the platform has mmap, so the pages are
+/// read in on demand and shared with the page cache; read into memory otherwise, and for files that
+/// cannot be mapped such as pipes.
+class mapped_file {
+  public:
+    explicit mapped_file(const std::filesystem::path &path);
+
+    mapped_file(const mapped_file &)            = delete;
+    mapped_file &operator=(const mapped_file &) = delete;
+
+    ~mapped_file();
+
+    /// False if the file could not be opened or read
+    [[nodiscard]] bool is_open() const noexcept { return open_; }
+
+    /// The bytes of the file; valid for the lifetime of this object
+    [[nodiscard]] std::string_view contents() const noexcept { return {data_, size_}; }
+
+  private:
+    const char *data_   = nullptr;
+    std::size_t size_   = 0;
+    bool        open_   = false;
+    bool        mapped_ = false;
+    std::string buffer_; // the contents when the file is read rather than mapped
+};
+
+} // namespace arbys::bignum::detail
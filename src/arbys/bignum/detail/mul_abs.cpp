@@ -2,106 +2,273 @@
 #include "big_int_internal.h"
 #include "detail.h"
 #include <algorithm>
-#include <ranges>
+#include <cassert>
+#include <span>
+#include <utility>
+#include <vector>
 
 namespace arbys::bignum::detail {
 
-std::pair<big_int, big_int> split_at(const big_int &num, const std::ptrdiff_t mid) {
-    const auto &digits = big_int_access::limbs(num);
+// Below this many limbs in the shorter operand schoolbook beats Karatsuba
+constexpr size_t karatsuba_threshold = 32;
 
-    if (mid >= static_cast<std::ptrdiff_t>(digits.size())) {
-        return {big_int_access::create(false, {}), num};
-    }
-
-    const std::vector<limb_t> low_digits(digits.begin(), digits.begin() + mid);
-    const std::vector<limb_t> high_digits(digits.begin() + mid, digits.end());
+// From this many limbs in the shorter operand the Toom-Cook tiers take over
+constexpr size_t toom3_threshold = 640;
+constexpr size_t toom4_threshold = 1600;
 
-    auto low  = big_int_access::create(false, low_digits);
-    auto high = big_int_access::create(false, high_digits);
+// The NTT works on 32-bit coefficients whatever the limb width, so 64-bit limbs reach it much later
+constexpr size_t ntt_threshold = LIMB_BITS == 64 ? 16000 : 4000;
 
-    return {high, low};
+limb_t mul_limb(std::span<limb_t> out, std::span<const limb_t> x, const limb_t m) noexcept {
+    limb_t carry = 0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        const dlimb_t prod = dlimb_t{x[i]} * m + carry;
+        out[i]             = static_cast<limb_t>(prod);
+        carry              = static_cast<limb_t>(prod >> LIMB_BITS);
+    }
+    return carry;
 }
 
-big_int shift_left(const big_int &num, std::ptrdiff_t n) {
-    if (num.is_zero() || n == 0) {
-        return num;
+void mul_basecase(std::span<limb_t> out, std::span<const limb_t> lhs, std::span<const limb_t> rhs) noexcept {
+    const size_t lhs_len = lhs.size();
+    const size_t rhs_len = rhs.size();
+
+    // first row initializes the output, so it does not need to be zeroed
+    limb_t carry = 0;
+    for (size_t j = 0; j < rhs_len; ++j) {
+        const dlimb_t prod = dlimb_t{lhs[0]} * rhs[j] + carry;
+        out[j]             = static_cast<limb_t>(prod);             // lower limb
+        carry              = static_cast<limb_t>(prod >> LIMB_BITS); // upper limb
     }
+    out[rhs_len] = carry;
 
-    const auto  &num_digits = big_int_access::limbs(num);
-    const size_t num_len    = big_int_access::length(num);
+    // multiply i'th limb of lhs with every limb of rhs and accumulate
+    for (size_t i = 1; i < lhs_len; ++i) {
+        carry = 0;
+        for (size_t j = 0; j < rhs_len; ++j) {
+            const dlimb_t prod = dlimb_t{lhs[i]} * rhs[j] + out[i + j] + carry;
+            out[i + j]         = static_cast<limb_t>(prod);
+            carry              = static_cast<limb_t>(prod >> LIMB_BITS);
+        }
+        out[i + rhs_len] = carry;
+    }
+}
 
-    std::vector<limb_t> result_digits(num_len + n, 0);
-    std::ranges::copy(num_digits, result_digits.begin() + n);
+size_t karatsuba_scratch_size(size_t n) noexcept {
+    // each level keeps |a0 - a1|, |b0 - b1| (h limbs each), one spare limb and their 2h-limb product
+    size_t size = 0;
+    while (n >= karatsuba_threshold) {
+        n = (n + 1) / 2;
+        size += 4 * n + 1;
+    }
+    return size;
+}
 
-    return big_int_access::create(big_int_access::is_negative(num), result_digits);
+// out[0, lhs.size() + rhs.size()) = lhs * rhs for operands in either order
+static void karatsuba_or_basecase(
+  std::span<limb_t>       out,
+  std::span<const limb_t> lhs,
+  std::span<const limb_t> rhs,
+  std::span<limb_t>       scratch
+) noexcept {
+    if (lhs.size() < rhs.size()) {
+        std::swap(lhs, rhs);
+    }
+    karatsuba_mul(out, lhs, rhs, scratch);
 }
 
-big_int simple_multiply(const big_int &lhs, const big_int &rhs) {
-    // Handle 0 case
-    if (lhs.is_zero() || rhs.is_zero()) {
-        return big_int_access::create(false, {0});
+void karatsuba_mul(
+  std::span<limb_t>       out,
+  std::span<const limb_t> lhs,
+  std::span<const limb_t> rhs,
+  std::span<limb_t>       scratch
+) noexcept {
+    const size_t lhs_len = lhs.size();
+    const size_t rhs_len = rhs.size();
+
+    if (rhs_len < karatsuba_threshold) {
+        mul_basecase(out, lhs, rhs);
+        return;
     }
 
-    const auto &lhs_limbs = big_int_access::limbs(lhs);
-    const auto &rhs_limbs = big_int_access::limbs(rhs);
+    // lhs = a1 * B^h + a0, rhs = b1 * B^h + b0
+    const size_t h = (lhs_len + 1) / 2;
+    const auto   a0 = lhs.first(h);
+    const auto   a1 = lhs.subspan(h);
 
-    const auto &lhs_len = big_int_access::length(lhs);
-    const auto &rhs_len = big_int_access::length(rhs);
+    if (rhs_len <= h) {
+        // rhs fits in the low half: lhs * rhs = a0 * rhs + (a1 * rhs) * B^h
+        const size_t high_len = a1.size() + rhs_len;
+        const auto   high     = scratch.first(high_len);
+        const auto   rest     = scratch.subspan(high_len);
 
-    std::vector<limb_t> result_limbs(lhs_len + rhs_len);
+        karatsuba_or_basecase(out.first(h + rhs_len), a0, rhs, rest);
+        karatsuba_or_basecase(high, a1, rhs, rest);
 
-    for (size_t i = 0; i < lhs_len; ++i) {
-        limb_t carry = 0;
+        const auto top = out.subspan(h);
+        std::fill(top.begin() + static_cast<std::ptrdiff_t>(rhs_len), top.end(), limb_t{0});
+        [[maybe_unused]] const limb_t carry = add_limbs(top, top, high);
+        assert(carry == 0);
+        return;
+    }
 
-        // multiply i'th limb of lhs_limbs to j'th limb of rhs_limbs
-        for (size_t j = 0; j < rhs_len; ++j) {
-            const dlimb_t prod = result_limbs[i + j] + static_cast<uint64_t>(lhs_limbs[i]) * rhs_limbs[j] + carry;
+    const auto b0 = rhs.first(h);
+    const auto b1 = rhs.subspan(h);
 
-            result_limbs[i + j] = static_cast<limb_t>(prod); // lower 32 bits
-            carry               = prod >> LIMB_BITS;         // upper 32 bits
-        }
+    // scratch layout: [ |a0 - a1| : h ][ |b0 - b1| : h ][ spare : 1 ][ vm1 : 2h ][ scratch for recursion ]
+    const auto a_diff = scratch.first(h);
+    const auto b_diff = scratch.subspan(h, h);
+    const auto vm1    = scratch.subspan(2 * h + 1, 2 * h);
+    const auto rest   = scratch.subspan(4 * h + 1);
 
-        // add the carry
-        size_t pos = i + rhs_len;
-        while (carry > 0) {
-            const uint64_t sum = result_limbs[pos] + carry;
-            result_limbs[pos]  = static_cast<limb_t>(sum); // lower 32 bits
-            carry              = sum >> LIMB_BITS;         // upper 32 bits
-            ++pos;
-        }
+    // signed differences, kept as magnitude plus sign
+    const bool a_neg = cmp_limbs(a0, a1) < 0;
+    const bool b_neg = cmp_limbs(b0, b1) < 0;
+    if (a_neg) {
+        std::fill(a_diff.begin(), a_diff.end(), limb_t{0});
+        std::ranges::copy(a1, a_diff.begin());
+        (void)sub_limbs(a_diff, a_diff, a0);
+    } else {
+        (void)sub_limbs(a_diff, a0, a1);
+    }
+    if (b_neg) {
+        std::fill(b_diff.begin(), b_diff.end(), limb_t{0});
+        std::ranges::copy(b1, b_diff.begin());
+        (void)sub_limbs(b_diff, b_diff, b0);
+    } else {
+        (void)sub_limbs(b_diff, b0, b1);
     }
 
-    return big_int_access::create(false, result_limbs);
+    // vm1 = |a0 - a1| * |b0 - b1|, v0 = a0 * b0, vinf = a1 * b1
+    karatsuba_mul(vm1, a_diff, b_diff, rest);
+    karatsuba_mul(out.first(2 * h), a0, b0, rest);
+    karatsuba_or_basecase(out.subspan(2 * h), a1, b1, rest);
+
+    // middle = v0 + vinf - (a0 - a1)(b0 - b1) = a0 * b1 + a1 * b0, built over the dead differences
+    const auto middle = scratch.first(2 * h + 1);
+    middle[2 * h]     = add_limbs(middle.first(2 * h), out.first(2 * h), out.subspan(2 * h));
+    if (a_neg == b_neg) {
+        [[maybe_unused]] const limb_t borrow = sub_limbs(middle, middle, vm1);
+        assert(borrow == 0);
+    } else {
+        [[maybe_unused]] const limb_t carry = add_limbs(middle, middle, vm1);
+        assert(carry == 0);
+    }
+
+    // out += middle * B^h; limbs of middle beyond the end of out are zero
+    const auto top = out.subspan(h);
+    [[maybe_unused]] const limb_t carry =
+      add_limbs(top, top, middle.first(std::min(middle.size(), top.size())));
+    assert(carry == 0);
+}
+
+// out[0, lhs.size() + rhs.size()) = lhs * rhs for lhs much longer than rhs: lhs is cut into rhs-sized
+// chunks, each balanced chunk product goes back through mul_limbs and is added in at its offset
+static void mul_unbalanced(std::span<limb_t> out, std::span<const limb_t> lhs, std::span<const limb_t> rhs) {
+    const size_t n = rhs.size();
+
+    mul_limbs(out.first(2 * n), lhs.first(n), rhs);
+
+    std::vector<limb_t> product(2 * n);
+    for (size_t offset = n; offset < lhs.size(); offset += n) {
+        const size_t len         = std::min(n, lhs.size() - offset);
+        const auto   chunk_out   = std::span<limb_t>(product).first(n + len);
+        const auto   window      = out.subspan(offset, n + len);
+        const auto   window_high = window.subspan(n);
+
+        mul_limbs(chunk_out, lhs.subspan(offset, len), rhs);
+
+        // the low n limbs of the window hold the top of the previous partial product, the rest is fresh
+        std::ranges::copy(chunk_out.subspan(n), window_high.begin());
+        const limb_t carry = add_limbs(window.first(n), window.first(n), chunk_out.first(n));
+        [[maybe_unused]] const limb_t overflow = add_limbs(window_high, window_high, std::span(&carry, 1));
+        assert(overflow == 0);
+    }
 }
 
-big_int karatsuba_multiply(const big_int &lhs, const big_int &rhs) {
-    constexpr size_t karatsuba_threshold = 32;
+void mul_limbs(std::span<limb_t> out, std::span<const limb_t> lhs, std::span<const limb_t> rhs) {
+    if (lhs.size() < rhs.size()) {
+        std::swap(lhs, rhs);
+    }
+
+    const size_t lhs_len = lhs.size();
+    const size_t rhs_len = rhs.size();
+
+    if (lhs.data() == rhs.data() && lhs_len == rhs_len) {
+        sqr_limbs(out, lhs);
+        return;
+    }
+
+    if (rhs_len < karatsuba_threshold) {
+        mul_basecase(out, lhs, rhs);
+        return;
+    }
+
+    // past ntt_max_limbs the Toom tiers split the operands into pieces the NTT can take again
+    if (rhs_len >= ntt_threshold && lhs_len + rhs_len <= ntt_max_limbs) {
+        ntt_mul(out, lhs, rhs);
+        return;
+    }
+
+    // Karatsuba already peels the excess of a longer lhs off in place, but it never reaches the Toom
+    // tiers again; from 2:1 on, rhs-sized chunks keep every balanced product on the best kernel
+    if (rhs_len >= toom3_threshold && lhs_len >= 2 * rhs_len) {
+        mul_unbalanced(out, lhs, rhs);
+        return;
+    }
 
-    const size_t lhs_len = big_int_access::length(lhs);
-    const size_t rhs_len = big_int_access::length(rhs);
+    // Toom-k only pays off when the shorter operand still fills (nearly) all k parts
+    if (rhs_len >= toom4_threshold && 4 * rhs_len > 3 * lhs_len) {
+        toom4_mul(out, lhs, rhs);
+        return;
+    }
+    if (rhs_len >= toom3_threshold) {
+        toom3_mul(out, lhs, rhs);
+        return;
+    }
 
-    if (lhs_len <= karatsuba_threshold || rhs_len <= karatsuba_threshold) {
-        return simple_multiply(lhs, rhs);
+    // one allocation up front; the recursion itself never allocates
+    std::vector<limb_t> scratch(karatsuba_scratch_size(lhs.size()));
+    karatsuba_mul(out, lhs, rhs, scratch);
+}
+
+big_int simple_multiply(const big_int_view lhs, const big_int_view rhs) {
+    // Handle 0 case
+    if (lhs.is_zero() || rhs.is_zero()) {
+        return big_int_access::create(false, {0});
     }
 
-    const size_t max_len = std::max(lhs_len, rhs_len);
-    const auto   mid     = static_cast<ptrdiff_t>(max_len / 2);
+    const auto lhs_limbs = lhs.limbs();
+    const auto rhs_limbs = rhs.limbs();
 
-    auto [high1, low1] = split_at(lhs, mid);
-    auto [high2, low2] = split_at(rhs, mid);
+    limb_vector result_limbs(lhs_limbs.size() + rhs_limbs.size());
+    mul_basecase(result_limbs, lhs_limbs, rhs_limbs);
 
-    const big_int z0 = karatsuba_multiply(low1, low2);
-    const big_int z2 = karatsuba_multiply(high1, high2);
+    return big_int_access::create(false, std::move(result_limbs));
+}
 
-    const big_int sum1 = low1 + high1;
-    const big_int sum2 = low2 + high2;
-    const big_int z1   = karatsuba_multiply(sum1, sum2) - z2 - z0;
+big_int karatsuba_multiply(const big_int_view lhs, const big_int_view rhs) {
+    auto lhs_limbs = lhs.limbs();
+    auto rhs_limbs = rhs.limbs();
+    if (lhs_limbs.size() < rhs_limbs.size()) {
+        std::swap(lhs_limbs, rhs_limbs);
+    }
 
-    auto result = shift_left(z2, 2 * mid) + shift_left(z1, mid) + z0;
+    limb_vector         result_limbs(lhs_limbs.size() + rhs_limbs.size());
+    std::vector<limb_t> scratch(karatsuba_scratch_size(lhs_limbs.size()));
+    karatsuba_mul(result_limbs, lhs_limbs, rhs_limbs, scratch);
 
-    return result;
+    return big_int_access::create(false, std::move(result_limbs));
 }
 
-big_int mul_abs(const big_int &lhs, const big_int &rhs) { return karatsuba_multiply(lhs, rhs); }
+big_int mul_abs(const big_int_view lhs, const big_int_view rhs) {
+    const auto lhs_limbs = lhs.limbs();
+    const auto rhs_limbs = rhs.limbs();
+
+    limb_vector result_limbs(lhs_limbs.size() + rhs_limbs.size());
+    mul_limbs(result_limbs, lhs_limbs, rhs_limbs);
+
+    return big_int_access::create(false, std::move(result_limbs));
+}
 
 } // namespace arbys::bignumbers::detail
@@ -1,4 +1,3 @@
-#include <vector>
 
 #include "arbys/bignum/big_int.h"
 #include "big_int_internal.h"
@@ -6,7 +5,7 @@
 namespace arbys::bignum::detail {
 
 /// Removes leading zero limbs (canonical form requirement)
-void trim_leading_zeros(std::vector<limb_t> &limbs) {
+void trim_leading_zeros(limb_vector &limbs) {
     while (limbs.size() > 1 && limbs.back() == 0) {
         limbs.pop_back();
     }
@@ -14,7 +13,7 @@ void trim_leading_zeros(std::vector<limb_t> &limbs) {
 
 /// Propagates carries through limbs and trims leading zeros
 /// Use after operations that may produce limbs >= BASE
-void propagate_carries(std::vector<limb_t> &limbs) {
+void propagate_carries(limb_vector &limbs) {
     dlimb_t carry = 0;
 
     for (limb_t &limb : limbs) {
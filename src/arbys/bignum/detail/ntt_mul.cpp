@@ -0,0 +1,249 @@
+#include "arbys/bignum/big_int.h"
+#include "big_int_internal.h"
+#include "detail.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace arbys::bignum::detail {
+
+// Three-prime number-theoretic transform. The operands are cut into 32-bit coefficients, the cyclic
+// convolution is computed modulo three NTT-friendly primes below 2^31 and each coefficient is
+// recovered with the Chinese remainder theorem. The primes' product is about 2^89, enough for
+// 2^25 products of two 32-bit coefficients, and the smallest 2-adicity caps the transform at 2^24
+// points; ntt_max_limbs in detail.h keeps callers below both limits.
+
+namespace {
+
+using u32 = std::uint32_t;
+using u64 = std::uint64_t;
+
+constexpr unsigned coefficient_bits = 32;
+constexpr size_t   pieces_per_limb  = LIMB_BITS / coefficient_bits;
+
+static_assert(LIMB_BITS % coefficient_bits == 0);
+static_assert(ntt_max_limbs * pieces_per_limb == size_t{1} << 24);
+
+// Arithmetic modulo an odd prime p < 2^31 in Montgomery form (R = 2^32)
+struct mod_field {
+    u32 p;
+    u32 neg_inv;  // -p^-1 mod 2^32
+    u32 r2;       // R^2 mod p
+    u32 generator;
+
+    constexpr mod_field(const u32 prime, const u32 primitive_root) noexcept
+        : p{prime}, neg_inv{0}, r2{0}, generator{primitive_root} {
+        u32 inv = prime; // correct to 3 bits, each Newton step doubles that
+        for (int i = 0; i < 4; ++i) {
+            inv *= 2 - prime * inv;
+        }
+        neg_inv = 0 - inv;
+        r2      = static_cast<u32>((u64{1} << 63) % prime * 2 % prime);
+    }
+
+    [[nodiscard]] constexpr u32 reduce(const u64 t) const noexcept {
+        const u32 m = static_cast<u32>(t) * neg_inv;
+        const u32 u = static_cast<u32>((t + u64{m} * p) >> 32);
+        return u >= p ? u - p : u;
+    }
+
+    [[nodiscard]] constexpr u32 mul(const u32 a, const u32 b) const noexcept { return reduce(u64{a} * b); }
+
+    [[nodiscard]] constexpr u32 add(const u32 a, const u32 b) const noexcept {
+        const u32 s = a + b;
+        return s >= p ? s - p : s;
+    }
+
+    [[nodiscard]] constexpr u32 sub(const u32 a, const u32 b) const noexcept { return a >= b ? a - b : a + p - b; }
+
+    [[nodiscard]] constexpr u32 to_mont(const u32 a) const noexcept { return mul(a % p, r2); }
+
+    [[nodiscard]] constexpr u32 from_mont(const u32 a) const noexcept { return reduce(a); }
+
+    // a^e for a in Montgomery form
+    [[nodiscard]] constexpr u32 pow(u32 a, u64 e) const noexcept {
+        u32 result = to_mont(1);
+        while (e) {
+            if (e & 1) {
+                result = mul(result, a);
+            }
+            a = mul(a, a);
+            e >>= 1;
+        }
+        return result;
+    }
+};
+
+constexpr mod_field field0{2013265921, 31}; // 15 * 2^27 + 1
+constexpr mod_field field1{469762049, 3};   //  7 * 2^26 + 1
+constexpr mod_field field2{754974721, 11};  // 45 * 2^24 + 1
+
+// roots[len + j] = w^j for the primitive (2 len)-th root of unity w, for every power of two len < n
+template <const mod_field &f> [[nodiscard]] std::vector<u32> root_table(const size_t n, const bool inverse) {
+    std::vector<u32> roots(std::max<size_t>(n, 2));
+    for (size_t len = 1; len < n; len *= 2) {
+        u32 w = f.pow(f.to_mont(f.generator), (f.p - 1) / (2 * len));
+        if (inverse) {
+            w = f.pow(w, f.p - 2);
+        }
+        u32 power = f.to_mont(1);
+        for (size_t j = 0; j < len; ++j) {
+            roots[len + j] = power;
+            power          = f.mul(power, w);
+        }
+    }
+    return roots;
+}
+
+// Decimation in frequency: natural order in, bit-reversed order out
+template <const mod_field &f> void forward(std::span<u32> a, std::span<const u32> roots) noexcept {
+    for (size_t len = a.size() / 2; len >= 1; len /= 2) {
+        const u32 *w = roots.data() + len;
+        for (size_t i = 0; i < a.size(); i += 2 * len) {
+            for (size_t j = 0; j < len; ++j) {
+                const u32 u    = a[i + j];
+                const u32 v    = a[i + j + len];
+                a[i + j]       = f.add(u, v);
+                a[i + j + len] = f.mul(f.sub(u, v), w[j]);
+            }
+        }
+    }
+}
+
+// Decimation in time with inverse roots: bit-reversed order in, natural order out (scaled by n)
+template <const mod_field &f> void inverse(std::span<u32> a, std::span<const u32> roots) noexcept {
+    for (size_t len = 1; len < a.size(); len *= 2) {
+        const u32 *w = roots.data() + len;
+        for (size_t i = 0; i < a.size(); i += 2 * len) {
+            for (size_t j = 0; j < len; ++j) {
+                const u32 u    = a[i + j];
+                const u32 v    = f.mul(a[i + j + len], w[j]);
+                a[i + j]       = f.add(u, v);
+                a[i + j + len] = f.sub(u, v);
+            }
+        }
+    }
+}
+
+// 32-bit coefficients of x, zero-padded to n
+template <const mod_field &f> void load(std::span<u32> out, std::span<const limb_t> x) noexcept {
+    size_t k = 0;
+    for (const limb_t limb : x) {
+        for (size_t piece = 0; piece < pieces_per_limb; ++piece) {
+            out[k++] = f.to_mont(static_cast<u32>(limb >> (piece * coefficient_bits)));
+        }
+    }
+    std::fill(out.begin() + static_cast<std::ptrdiff_t>(k), out.end(), u32{0});
+}
+
+// Residues of the convolution modulo one prime, in plain (non-Montgomery) form
+template <const mod_field &f>
+[[nodiscard]] std::vector<u32>
+convolve(std::span<const limb_t> lhs, std::span<const limb_t> rhs, const size_t n, const bool square) {
+    const std::vector<u32> roots     = root_table<f>(n, false);
+    const std::vector<u32> inv_roots = root_table<f>(n, true);
+
+    std::vector<u32> a(n);
+    load<f>(a, lhs);
+    forward<f>(a, roots);
+
+    if (square) {
+        for (u32 &x : a) {
+            x = f.mul(x, x);
+        }
+    } else {
+        std::vector<u32> b(n);
+        load<f>(b, rhs);
+        forward<f>(b, roots);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = f.mul(a[i], b[i]);
+        }
+    }
+
+    inverse<f>(a, inv_roots);
+
+    // multiplying by plain n^-1 both divides by n and leaves the Montgomery domain
+    const u32 n_inv = f.from_mont(f.pow(f.to_mont(static_cast<u32>(n % f.p)), f.p - 2));
+    for (u32 &x : a) {
+        x = f.mul(x, n_inv);
+    }
+    return a;
+}
+
+// Combines the three residue vectors into out, propagating carries between 32-bit positions
+void recombine(std::span<limb_t> out, const std::array<std::vector<u32>, 3> &residues) noexcept {
+    constexpr u64 p0 = field0.p;
+    constexpr u64 p1 = field1.p;
+    constexpr u64 p2 = field2.p;
+
+    // Garner: x = r0 + p0 * t1 + p0 p1 * t2
+    // both inverses are kept in Montgomery form, so multiplying a plain residue by them yields a plain value
+    constexpr u32 p0_inv_mod_p1   = field1.pow(field1.to_mont(static_cast<u32>(p0 % p1)), p1 - 2);
+    constexpr u64 p0p1            = p0 * p1;
+    constexpr u32 p0p1_inv_mod_p2 = field2.pow(field2.to_mont(static_cast<u32>(p0p1 % p2)), p2 - 2);
+
+    const size_t words = out.size() * pieces_per_limb;
+    std::ranges::fill(out, limb_t{0});
+
+    u64 carry = 0; // stays below 2^60
+    for (size_t i = 0; i < words; ++i) {
+        const u32 r0 = residues[0][i];
+        const u32 r1 = residues[1][i];
+        const u32 r2 = residues[2][i];
+
+        const u32 t1  = field1.mul(field1.sub(r1, static_cast<u32>(r0 % p1)), p0_inv_mod_p1);
+        const u64 x01 = r0 + p0 * t1; // < p0 p1 < 2^61
+
+        const u32 t2 = field2.mul(field2.sub(r2, static_cast<u32>(x01 % p2)), p0p1_inv_mod_p2);
+
+        // (lo, hi) = carry + x01 + p0 p1 t2, below 2^91
+        const u64 m_lo = (p0p1 & 0xffffffffu) * t2;
+        const u64 m_hi = (p0p1 >> 32) * t2;
+        const u64 mid  = m_hi << 32;
+        u64       lo   = carry;
+        u64       hi   = m_hi >> 32;
+
+        lo += m_lo;
+        hi += lo < m_lo;
+        lo += mid;
+        hi += lo < mid;
+        lo += x01;
+        hi += lo < x01;
+
+        const limb_t word = static_cast<u32>(lo);
+        out[i / pieces_per_limb] |= word << (i % pieces_per_limb * coefficient_bits);
+        carry = (lo >> 32) | (hi << 32);
+    }
+    assert(carry == 0);
+}
+
+void ntt_product(std::span<limb_t> out, std::span<const limb_t> lhs, std::span<const limb_t> rhs, const bool square) {
+    assert(!lhs.empty() && !rhs.empty());
+    assert(lhs.size() + rhs.size() <= ntt_max_limbs);
+
+    const size_t coefficients = (lhs.size() + rhs.size()) * pieces_per_limb;
+    const size_t n            = std::bit_ceil(coefficients);
+
+    const std::array<std::vector<u32>, 3> residues = {
+      convolve<field0>(lhs, rhs, n, square),
+      convolve<field1>(lhs, rhs, n, square),
+      convolve<field2>(lhs, rhs, n, square),
+    };
+
+    recombine(out.first(lhs.size() + rhs.size()), residues);
+}
+
+} // namespace
+
+void ntt_mul(std::span<limb_t> out, std::span<const limb_t> lhs, std::span<const limb_t> rhs) {
+    ntt_product(out, lhs, rhs, false);
+}
+
+void ntt_sqr(std::span<limb_t> out, std::span<const limb_t> x) { ntt_product(out, x, x, true); }
+
+} // namespace arbys::bignum::detail
@@ -0,0 +1,188 @@
+#include "detail.h"
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+// The vector kernels are compiled with per-function target attributes, so the library itself needs no
+// -msse4.1 / -mavx2 and still runs on any x86-64; the CPU is asked which one to use on first call
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define ARBYS_BIGNUM_X86_DIGIT_KERNELS 1
+#include <immintrin.h>
+#else
+#define ARBYS_BIGNUM_X86_DIGIT_KERNELS 0
+#endif
+
+namespace arbys::bignum::detail {
+
+constexpr size_t        block_digits = 16;
+constexpr std::uint64_t ten_to_8     = 100'000'000;
+
+using block_kernel = bool (*)(const char *, size_t, std::uint64_t *) noexcept;
+
+// Value of the 8 digits at p, validating them on the way; SWAR over one 64-bit word
+[[nodiscard]] static bool parse_8_digits(const char *p, std::uint64_t &value) noexcept {
+    if constexpr (std::endian::native == std::endian::little) {
+        std::uint64_t word;
+        std::memcpy(&word, p, sizeof word);
+
+        // every byte in '0'..'9': high nibble 3, and still 3 after adding 6 to the low nibble
+        constexpr std::uint64_t high_nibbles = 0xF0F0'F0F0'F0F0'F0F0;
+        if ((word & high_nibbles) != 0x3030'3030'3030'3030
+            || ((word + 0x0606'0606'0606'0606) & high_nibbles) != 0x3030'3030'3030'3030) {
+            return false;
+        }
+
+        // the first character sits in the lowest byte: fold pairs, then quads, then the two halves
+        word -= 0x3030'3030'3030'3030;
+        word = (word * 10 + (word >> 8)) & 0x00FF'00FF'00FF'00FF;
+        word = (word * 100 + (word >> 16)) & 0x0000'FFFF'0000'FFFF;
+        value = (word * 10000 + (word >> 32)) & 0xFFFF'FFFF;
+        return true;
+    } else {
+        value = 0;
+        for (size_t i = 0; i < 8; ++i) {
+            const auto digit = static_cast<unsigned char>(p[i] - '0');
+            if (digit > 9) {
+                return false;
+            }
+            value = value * 10 + digit;
+        }
+        return true;
+    }
+}
+
+static bool blocks_scalar(const char *digits, const size_t blocks, std::uint64_t *values) noexcept {
+    for (size_t i = 0; i < blocks; ++i, digits += block_digits) {
+        std::uint64_t high;
+        std::uint64_t low;
+        if (!parse_8_digits(digits, high) || !parse_8_digits(digits + 8, low)) {
+            return false;
+        }
+        values[i] = high * ten_to_8 + low;
+    }
+    return true;
+}
+
+#if ARBYS_BIGNUM_X86_DIGIT_KERNELS
+
+// One block per iteration: digit pairs with maddubs, quads with madd, then pack and madd once more
+// into the two 8-digit halves. Validation is folded into the same pass and checked once at the end.
+__attribute__((target("sse4.1"))) static bool blocks_sse41(
+  const char    *digits,
+  const size_t   blocks,
+  std::uint64_t *values
+) noexcept {
+    const __m128i zero      = _mm_set1_epi8('0');
+    const __m128i nine      = _mm_set1_epi8(9);
+    const __m128i by_10     = _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1);
+    const __m128i by_100    = _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1);
+    const __m128i by_10000  = _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1);
+    __m128i       all_valid = _mm_set1_epi8(-1);
+
+    for (size_t i = 0; i < blocks; ++i) {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(digits + i * block_digits));
+        const __m128i d     = _mm_sub_epi8(chars, zero);
+        all_valid           = _mm_and_si128(all_valid, _mm_cmpeq_epi8(_mm_max_epu8(d, nine), nine));
+
+        const __m128i pairs  = _mm_maddubs_epi16(d, by_10);
+        const __m128i quads  = _mm_madd_epi16(pairs, by_100);
+        const __m128i halves = _mm_madd_epi16(_mm_packus_epi32(quads, quads), by_10000);
+
+        const auto high = static_cast<std::uint32_t>(_mm_cvtsi128_si32(halves));
+        const auto low  = static_cast<std::uint32_t>(_mm_extract_epi32(halves, 1));
+        values[i]       = high * ten_to_8 + low;
+    }
+    return _mm_movemask_epi8(all_valid) == 0xFFFF;
+}
+
+// Two blocks per iteration, one in each 128-bit lane; the odd block left over goes to the SSE kernel
+__attribute__((target("avx2"))) static bool blocks_avx2(
+  const char    *digits,
+  const size_t   blocks,
+  std::uint64_t *values
+) noexcept {
+    const __m256i zero      = _mm256_set1_epi8('0');
+    const __m256i nine      = _mm256_set1_epi8(9);
+    const __m256i by_10     = _mm256_set1_epi16(0x010A); // bytes 10, 1
+    const __m256i by_100    = _mm256_set1_epi32(0x0001'0064); // words 100, 1
+    const __m256i by_10000  = _mm256_set1_epi32(0x0001'2710); // words 10000, 1
+    __m256i       all_valid = _mm256_set1_epi8(-1);
+
+    size_t i = 0;
+    for (; i + 2 <= blocks; i += 2) {
+        const __m256i chars =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i *>(digits + i * block_digits));
+        const __m256i d = _mm256_sub_epi8(chars, zero);
+        all_valid       = _mm256_and_si256(all_valid, _mm256_cmpeq_epi8(_mm256_max_epu8(d, nine), nine));
+
+        const __m256i pairs  = _mm256_maddubs_epi16(d, by_10);
+        const __m256i quads  = _mm256_madd_epi16(pairs, by_100);
+        const __m256i halves = _mm256_madd_epi16(_mm256_packus_epi32(quads, quads), by_10000);
+
+        values[i] = static_cast<std::uint32_t>(_mm256_extract_epi32(halves, 0)) * ten_to_8
+                    + static_cast<std::uint32_t>(_mm256_extract_epi32(halves, 1));
+        values[i + 1] = static_cast<std::uint32_t>(_mm256_extract_epi32(halves, 4)) * ten_to_8
+                        + static_cast<std::uint32_t>(_mm256_extract_epi32(halves, 5));
+    }
+    if (_mm256_movemask_epi8(all_valid) != -1) {
+        return false;
+    }
+    return i == blocks || blocks_sse41(digits + i * block_digits, blocks - i, values + i);
+}
+
+#endif
+
+[[nodiscard]] static block_kernel kernel_for(const digit_kernel kernel) noexcept {
+    switch (kernel) {
+#if ARBYS_BIGNUM_X86_DIGIT_KERNELS
+    case digit_kernel::avx2:
+        return blocks_avx2;
+    case digit_kernel::sse41:
+        return blocks_sse41;
+#endif
+    default:
+        return blocks_scalar;
+    }
+}
+
+[[nodiscard]] static block_kernel best_kernel() noexcept {
+    for (const digit_kernel kernel : {digit_kernel::avx2, digit_kernel::sse41}) {
+        if (digit_kernel_supported(kernel)) {
+            return kernel_for(kernel);
+        }
+    }
+    return blocks_scalar;
+}
+
+bool digit_kernel_supported(const digit_kernel kernel) noexcept {
+    switch (kernel) {
+    case digit_kernel::scalar:
+        return true;
+#if ARBYS_BIGNUM_X86_DIGIT_KERNELS
+    case digit_kernel::sse41:
+        return __builtin_cpu_supports("sse4.1");
+    case digit_kernel::avx2:
+        return __builtin_cpu_supports("avx2");
+#endif
+    default:
+        return false;
+    }
+}
+
+bool parse_digit_blocks(const std::string_view digits, const std::span<std::uint64_t> values) noexcept {
+    static const block_kernel kernel = best_kernel();
+    return kernel(digits.data(), values.size(), values.data());
+}
+
+bool parse_digit_blocks(
+  const digit_kernel             kernel,
+  const std::string_view         digits,
+  const std::span<std::uint64_t> values
+) noexcept {
+    return kernel_for(kernel)(digits.data(), values.size(), values.data());
+}
+
+} // namespace arbys::bignum::detail
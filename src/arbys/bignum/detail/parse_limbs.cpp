@@ -1,87 +1,156 @@
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
 #include <expected>
-#include <locale>
-#include <ranges>
+#include <optional>
+#include <span>
 #include <string_view>
 #include <vector>
 
 #include "arbys/bignum/big_int.h"
 #include "arbys/bignum/errors.h"
 #include "big_int_internal.h"
-
-#include <algorithm>
-#include <cctype>
-#include <expected>
-#include <string_view>
+#include "detail.h"
 
 namespace arbys::bignum::detail {
 
-/// Convert decimal string to base 2^32 representation
-/// Algorithm: Repeatedly multiply accumulator by 10 and add next digit
-[[nodiscard]] std::expected<big_int, errors::ParseError> parse_limbs(
-  std::string_view input,
-  const bool       is_negative
-) noexcept {
-    // Skip leading zeros
-    while (!input.empty() && input.front() == '0') {
-        input.remove_prefix(1);
+// Above this many digits the string is split in two and recombined as hi * 10^k + lo, so the work goes
+// to the fast multiplication instead of one pass over the accumulator per block
+constexpr size_t from_string_dc_threshold = 1200;
+
+constexpr size_t chunk_digits = DEC_CHUNK_DIGITS;
+
+// The digit kernels deliver 16-digit blocks; with 32-bit limbs each is folded in as two 8-digit steps
+constexpr size_t block_digits = 16;
+constexpr size_t step_digits  = LIMB_BITS == 64 ? 16 : 8;
+constexpr limb_t step_base    = static_cast<limb_t>(LIMB_BITS == 64 ? 10'000'000'000'000'000ULL : 100'000'000ULL);
+
+// Blocks converted per call into the kernels
+constexpr size_t blocks_per_batch = 64;
+
+// limbs = limbs * multiplier + addend
+// Precondition: addend < multiplier
+static void mul_add_limb(limb_vector &limbs, const limb_t multiplier, limb_t addend) {
+    const limb_t carry = mul_limb(limbs, limbs, multiplier);
+
+    for (size_t i = 0; i < limbs.size() && addend != 0; ++i) {
+        limbs[i] += addend;
+        addend = limbs[i] < addend ? 1 : 0;
     }
 
-    // Handle zero case
-    if (input.empty()) {
-        return big_int_access::create(false, std::vector<limb_t>{0});
+    // carry < multiplier, so adding the spilled unit cannot wrap
+    if (const limb_t top = carry + addend; top != 0) {
+        limbs.push_back(top);
     }
+}
 
-    // Validate all characters are digits
-    for (char c : input) {
-        if (!std::isdigit(static_cast<unsigned char>(c))) {
-            return std::unexpected(errors::ParseError::InvalidCharacter);
+/// Chunked accumulation over 16-digit blocks, converted and validated a batch at a time by the digit kernels
+/// Returns nothing if a byte is not a decimal digit
+/// Precondition: digits non-empty
+[[nodiscard]] static std::optional<limb_vector> accumulate_blocks(const std::string_view digits) {
+    limb_vector limbs;
+    limbs.reserve(digits.size() * 3322 / 1000 / LIMB_BITS + 1); // log2(10) < 3.322, so small values stay inline
+
+    // the leading partial block first, so every later block is a full one
+    const size_t  head  = digits.size() % block_digits;
+    std::uint64_t first = 0;
+    for (const char c : digits.substr(0, head)) {
+        const auto digit = static_cast<unsigned char>(c - '0');
+        if (digit > 9) {
+            return std::nullopt;
         }
+        first = first * 10 + digit;
     }
-
-    // Start with zero
-    std::vector<limb_t> limbs{0};
-
-    // Process each decimal digit
-    for (const char c : input) {
-        const auto digit = static_cast<limb_t>(c - '0');
-
-        // Multiply current number by 10
-        dlimb_t carry = 0;
-        for (limb_t &limb : limbs) {
-            const dlimb_t product = dlimb_t{limb} * 10 + carry;
-            limb                  = static_cast<limb_t>(product);
-            carry                 = product >> LIMB_BITS;
+    limbs.push_back(static_cast<limb_t>(first));
+    if constexpr (LIMB_BITS == 32) {
+        if (first >> 32 != 0) {
+            limbs.push_back(static_cast<limb_t>(first >> 32));
         }
+    }
 
-        // Add carry if multiplication overflowed
-        if (carry > 0) {
-            limbs.push_back(static_cast<limb_t>(carry));
+    std::array<std::uint64_t, blocks_per_batch> values;
+    for (size_t pos = head; pos < digits.size();) {
+        const auto batch = std::span(values).first(std::min(blocks_per_batch, (digits.size() - pos) / block_digits));
+        if (!parse_digit_blocks(digits.substr(pos), batch)) {
+            return std::nullopt;
         }
 
-        // Add current digit
-        carry = digit;
-        for (size_t i = 0; i < limbs.size() && carry > 0; ++i) {
-            const dlimb_t sum = dlimb_t{limbs[i]} + carry;
-            limbs[i]          = static_cast<limb_t>(sum);
-            carry             = sum >> LIMB_BITS;
+        for (const std::uint64_t value : batch) {
+            if constexpr (step_digits == block_digits) {
+                mul_add_limb(limbs, step_base, static_cast<limb_t>(value));
+            } else {
+                mul_add_limb(limbs, step_base, static_cast<limb_t>(value / step_base));
+                mul_add_limb(limbs, step_base, static_cast<limb_t>(value % step_base));
+            }
         }
+        pos += batch.size() * block_digits;
+    }
+    return limbs;
+}
 
-        // Add carry if addition overflowed
-        if (carry > 0) {
-            limbs.push_back(static_cast<limb_t>(carry));
+/// Value of a digit string (leading zeros allowed) as hi * 10^(DEC_CHUNK_DIGITS * 2^k) + lo, with lo
+/// taking the largest such power below the digit count so the halves stay balanced
+/// Returns nothing if a byte is not a decimal digit; the lower half is checked before the multiplication
+[[nodiscard]] static std::optional<big_int> parse_recursive(const std::string_view digits) {
+    if (digits.size() <= from_string_dc_threshold) {
+        auto limbs = accumulate_blocks(digits);
+        if (!limbs) {
+            return std::nullopt;
         }
+        return big_int_access::create_abs(std::move(*limbs));
+    }
+
+    size_t k = 0;
+    while ((chunk_digits << (k + 1)) < digits.size()) {
+        ++k;
+    }
+    const size_t low_digits = chunk_digits << k;
+
+    std::optional<big_int> high = parse_recursive(digits.substr(0, digits.size() - low_digits));
+    if (!high) {
+        return std::nullopt;
+    }
+    std::optional<big_int> low = parse_recursive(digits.substr(digits.size() - low_digits));
+    if (!low) {
+        return std::nullopt;
+    }
+
+    *high *= decimal_power_at(k, false).value;
+    *high += *low;
+    return high;
+}
+
+/// Convert decimal string to base 2^LIMB_BITS representation
+/// Chunked accumulation for short and medium inputs, divide and conquer over cached powers of ten above;
+/// the digits are validated as they are converted, in a single pass
+[[nodiscard]] std::expected<big_int, errors::ParseError> parse_limbs(
+  std::string_view input,
+  const bool       is_negative
+) {
+    // Skip leading zeros
+    while (!input.empty() && input.front() == '0') {
+        input.remove_prefix(1);
+    }
+
+    // Handle zero case
+    if (input.empty()) {
+        return big_int_access::create(false, limb_vector{0});
     }
 
-    return big_int_access::create(is_negative, std::move(limbs));
+    std::optional<big_int> value = parse_recursive(input);
+    if (!value) {
+        return std::unexpected(errors::ParseError::InvalidCharacter);
+    }
+    big_int_access::impl(*value).is_negative_ = is_negative;
+    return std::move(*value);
 }
 
-/// Parse decimal chunks for better performance
-/// Process multiple digits at once to reduce limb operations
+/// Parse decimal blocks only: one pass over the limbs per 16 digits, quadratic in the length
 [[nodiscard]] std::expected<big_int, errors::ParseError> parse_limbs_optimized(
   std::string_view input,
   const bool       is_negative
-) noexcept {
+) {
     // Skip leading zeros
     while (!input.empty() && input.front() == '0') {
         input.remove_prefix(1);
@@ -89,92 +158,140 @@ namespace arbys::bignum::detail {
 
     // Handle zero case
     if (input.empty()) {
-        return big_int_access::create(false, std::vector<limb_t>{0});
+        return big_int_access::create(false, limb_vector{0});
     }
 
-    // Validate all characters are digits
-    for (char c : input) {
-        if (!std::isdigit(static_cast<unsigned char>(c))) {
-            return std::unexpected(errors::ParseError::InvalidCharacter);
-        }
+    auto limbs = accumulate_blocks(input);
+    if (!limbs) {
+        return std::unexpected(errors::ParseError::InvalidCharacter);
     }
+    return big_int_access::create(is_negative, std::move(*limbs));
+}
+
+// Value of every byte as a digit in bases up to 36, letters in either case; 0xFF for anything else
+constexpr auto digit_values = [] {
+    std::array<unsigned char, 256> values{};
+    values.fill(0xFF);
+    for (unsigned char i = 0; i < 10; ++i) {
+        values['0' + i] = i;
+    }
+    for (unsigned char i = 0; i < 26; ++i) {
+        values['a' + i] = values['A' + i] = static_cast<unsigned char>(10 + i);
+    }
+    return values;
+}();
+
+[[nodiscard]] static unsigned digit_value(const char c) noexcept {
+    return digit_values[static_cast<unsigned char>(c)];
+}
 
-    // Process 9 digits at a time (10^9 < 2^32)
-    constexpr size_t chunk_size = 9;
+size_t digit_run(const std::string_view input, const unsigned base) noexcept {
+    const auto end = std::ranges::find_if(input, [base](const char c) { return digit_value(c) >= base; });
+    return static_cast<size_t>(end - input.begin());
+}
 
-    std::vector<limb_t> limbs{0};
+/// Power-of-two bases: each digit is a fixed run of bits, packed straight into limbs from the least
+/// significant end in one pass
+/// Returns nothing if a character is not a digit of the base
+[[nodiscard]] static std::optional<limb_vector> pack_bits(const std::string_view digits, const unsigned base) {
+    const auto bits_per_digit = static_cast<unsigned>(std::countr_zero(base));
 
-    // Process full chunks from the end
-    size_t pos = input.size();
-    while (pos >= chunk_size) {
-        pos -= chunk_size;
-        std::string_view chunk = input.substr(pos, chunk_size);
+    limb_vector limbs;
+    limbs.reserve(digits.size() * bits_per_digit / LIMB_BITS + 1);
 
-        // Convert chunk to integer
-        limb_t chunk_value = 0;
-        for (const char ch : chunk) {
-            chunk_value = chunk_value * 10 + (ch - '0');
+    dlimb_t  window      = 0;
+    unsigned window_bits = 0;
+    for (auto it = digits.rbegin(); it != digits.rend(); ++it) {
+        const unsigned digit = digit_value(*it);
+        if (digit >= base) {
+            return std::nullopt;
         }
 
-        // Multiply existing limbs by 10^9
-        dlimb_t carry = 0;
-        for (limb_t &limb : limbs) {
-            constexpr limb_t chunk_multiplier = 1'000'000'000;
-            const dlimb_t    product          = dlimb_t{limb} * chunk_multiplier + carry;
-            limb                              = static_cast<limb_t>(product);
-            carry                             = product >> LIMB_BITS;
-        }
-        if (carry > 0) {
-            limbs.push_back(static_cast<limb_t>(carry));
+        window |= dlimb_t{digit} << window_bits;
+        window_bits += bits_per_digit;
+        if (window_bits >= LIMB_BITS) {
+            limbs.push_back(static_cast<limb_t>(window));
+            window >>= LIMB_BITS;
+            window_bits -= LIMB_BITS;
         }
+    }
+    if (window_bits > 0 || limbs.empty()) {
+        limbs.push_back(static_cast<limb_t>(window));
+    }
+    return limbs;
+}
 
-        // Add chunk value
-        carry = chunk_value;
-        for (size_t i = 0; i < limbs.size() && carry > 0; ++i) {
-            const dlimb_t sum = dlimb_t{limbs[i]} + carry;
-            limbs[i]          = static_cast<limb_t>(sum);
-            carry             = sum >> LIMB_BITS;
+/// Chunked accumulation in any base: limbs = limbs * base^chunk.digits + next chunk
+/// Returns nothing if a character is not a digit of the base
+/// Precondition: digits non-empty
+[[nodiscard]] static std::optional<limb_vector> accumulate_radix_chunks(
+  const std::string_view digits,
+  const unsigned         base,
+  const radix_chunk      chunk
+) {
+    limb_vector limbs;
+    limbs.reserve(digits.size() * static_cast<size_t>(std::bit_width(base)) / LIMB_BITS + 2);
+
+    // the leading partial chunk first, so every later chunk is a full one
+    size_t next = digits.size() % chunk.digits == 0 ? chunk.digits : digits.size() % chunk.digits;
+    limb_t value = 0;
+    for (size_t pos = 0; pos < digits.size(); ++pos) {
+        const unsigned digit = digit_value(digits[pos]);
+        if (digit >= base) {
+            return std::nullopt;
         }
-        if (carry > 0) {
-            limbs.push_back(static_cast<limb_t>(carry));
+        value = value * base + digit;
+
+        if (pos + 1 == next) {
+            if (limbs.empty()) {
+                limbs.push_back(value);
+            } else {
+                mul_add_limb(limbs, chunk.value, value);
+            }
+            value = 0;
+            next += chunk.digits;
         }
     }
+    return limbs;
+}
 
-    // Process remaining digits (less than chunk_size)
-    if (pos > 0) {
-        const std::string_view remaining       = input.substr(0, pos);
-        limb_t                 remaining_value = 0;
-        limb_t                 multiplier      = 1;
-
-        for (const char it : std::ranges::reverse_view(remaining)) {
-            remaining_value += (it - '0') * multiplier;
-            multiplier *= 10;
+/// Any base: hi * base^(chunk.digits * 2^k) + lo over powers built by squaring for this one parse,
+/// mirroring parse_recursive
+[[nodiscard]] static std::optional<big_int> parse_radix_recursive(
+  const std::string_view digits,
+  const unsigned         base,
+  const radix_chunk      chunk,
+  std::vector<big_int>  &powers
+) {
+    if (digits.size() <= from_string_dc_threshold) {
+        auto limbs = accumulate_radix_chunks(digits, base, chunk);
+        if (!limbs) {
+            return std::nullopt;
         }
+        return big_int_access::create_abs(std::move(*limbs));
+    }
 
-        // Multiply by appropriate power of 10
-        dlimb_t carry = 0;
-        for (limb_t &limb : limbs) {
-            const dlimb_t product = dlimb_t{limb} * multiplier + carry;
-            limb                  = static_cast<limb_t>(product);
-            carry                 = product >> LIMB_BITS;
-        }
-        if (carry > 0) {
-            limbs.push_back(static_cast<limb_t>(carry));
-        }
+    size_t k = 0;
+    while ((chunk.digits << (k + 1)) < digits.size()) {
+        ++k;
+    }
+    const size_t low_digits = chunk.digits << k;
 
-        // Add remaining value
-        carry = remaining_value;
-        for (size_t i = 0; i < limbs.size() && carry > 0; ++i) {
-            const dlimb_t sum = dlimb_t{limbs[i]} + carry;
-            limbs[i]          = static_cast<limb_t>(sum);
-            carry             = sum >> LIMB_BITS;
-        }
-        if (carry > 0) {
-            limbs.push_back(static_cast<limb_t>(carry));
-        }
+    std::optional<big_int> high = parse_radix_recursive(digits.substr(0, digits.size() - low_digits), base, chunk, powers);
+    if (!high) {
+        return std::nullopt;
+    }
+    std::optional<big_int> low = parse_radix_recursive(digits.substr(digits.size() - low_digits), base, chunk, powers);
+    if (!low) {
+        return std::nullopt;
     }
 
-    return big_int_access::create(is_negative, std::move(limbs));
+    while (powers.size() <= k) {
+        powers.push_back(powers.empty() ? big_int_access::create_abs({chunk.value}) : powers.back().square());
+    }
+    *high *= powers[k];
+    *high += *low;
+    return high;
 }
 
 /// Convert string in given base to BigInt
@@ -182,14 +299,14 @@ namespace arbys::bignum::detail {
   std::string_view input,
   const bool       is_negative,
   const unsigned   base
-) noexcept {
+) {
     if (base < 2 || base > 36) {
         return std::unexpected(errors::ParseError::InvalidBase);
     }
 
-    // For base 10, use optimized version
+    // For base 10, use the tiered decimal parser
     if (base == 10) {
-        return parse_limbs_optimized(input, is_negative);
+        return parse_limbs(input, is_negative);
     }
 
     // Skip leading zeros
@@ -198,53 +315,24 @@ namespace arbys::bignum::detail {
     }
 
     if (input.empty()) {
-        return big_int_access::create(false, std::vector<limb_t>{0});
+        return big_int_access::create(false, limb_vector{0});
     }
 
-    std::vector<limb_t> limbs{0};
-
-    for (const char c : input) {
-        limb_t digit;
-
-        // Convert character to digit value
-        if (c >= '0' && c <= '9') {
-            digit = c - '0';
-        } else if (c >= 'a' && c <= 'z') {
-            digit = c - 'a' + 10;
-        } else if (c >= 'A' && c <= 'Z') {
-            digit = c - 'A' + 10;
-        } else {
-            return std::unexpected(errors::ParseError::InvalidCharacter);
-        }
-
-        if (digit >= base) {
-            return std::unexpected(errors::ParseError::InvalidCharacter);
-        }
-
-        // Multiply current number by base
-        dlimb_t carry = 0;
-        for (limb_t &limb : limbs) {
-            const dlimb_t product = dlimb_t{limb} * base + carry;
-            limb                  = static_cast<limb_t>(product);
-            carry                 = product >> LIMB_BITS;
-        }
-        if (carry > 0) {
-            limbs.push_back(static_cast<limb_t>(carry));
-        }
-
-        // Add digit
-        carry = digit;
-        for (size_t i = 0; i < limbs.size() && carry > 0; ++i) {
-            const dlimb_t sum = dlimb_t{limbs[i]} + carry;
-            limbs[i]          = static_cast<limb_t>(sum);
-            carry             = sum >> LIMB_BITS;
-        }
-        if (carry > 0) {
-            limbs.push_back(static_cast<limb_t>(carry));
+    std::optional<big_int> value;
+    if (std::has_single_bit(base)) {
+        if (auto limbs = pack_bits(input, base)) {
+            value = big_int_access::create_abs(std::move(*limbs));
         }
+    } else {
+        std::vector<big_int> powers;
+        value = parse_radix_recursive(input, base, chunk_for_base(base), powers);
     }
 
-    return big_int_access::create(is_negative, std::move(limbs));
+    if (!value) {
+        return std::unexpected(errors::ParseError::InvalidCharacter);
+    }
+    big_int_access::impl(*value).is_negative_ = is_negative;
+    return std::move(*value);
 }
 
-} // namespace arbys::bignumbers::detail
+} // namespace arbys::bignum::detail
@@ -0,0 +1,234 @@
+#include "arbys/bignum/big_int.h"
+#include "arbys/bignum/errors.h"
+#include "big_int_internal.h"
+#include "detail.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <expected>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace arbys::bignum::detail {
+
+// Validation splits the input into at most this many ranges per thread, each at least range_min_chars
+// long, so a slow range does not hold up the others for long
+constexpr size_t ranges_per_thread = 4;
+constexpr size_t range_min_chars   = size_t{1} << 16;
+
+constexpr size_t invalid_range = std::numeric_limits<size_t>::max();
+
+// Runs task(i) for every i below count on up to `threads` threads, the calling one included; the first
+// exception a task throws is rethrown here once every thread has stopped
+template <class Task> static void parallel_for(const size_t count, const unsigned threads, const Task &task) {
+    std::atomic<size_t> next{0};
+    std::exception_ptr  error;
+    std::mutex          error_mutex;
+
+    const auto worker = [&] {
+        try {
+            for (size_t i = next++; i < count; i = next++) {
+                task(i);
+            }
+        } catch (...) {
+            const std::scoped_lock lock(error_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+            next = count;
+        }
+    };
+
+    {
+        std::vector<std::jthread> pool;
+        for (size_t t = 1; t < std::min<size_t>(threads, count); ++t) {
+            pool.emplace_back(worker);
+        }
+        worker();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+[[nodiscard]] static bool is_digit(const char c) noexcept { return c >= '0' && c <= '9'; }
+
+// Visits the digits of text in order, skipping separators the way from_string(input, separator) does: a
+// separator match wins over a digit. Returns false at the first character that is neither.
+// Precondition: separator non-empty
+template <class Visit>
+[[nodiscard]] static bool for_each_digit(const std::string_view text, const std::string_view separator, Visit &&visit) {
+    for (size_t pos = 0; pos < text.size();) {
+        if (text.compare(pos, separator.size(), separator) == 0) {
+            pos += separator.size();
+        } else if (is_digit(text[pos])) {
+            visit(pos);
+            ++pos;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Starts of the ranges validation splits text into, plus text.size() at the end. Every start but the
+// first is a digit: a separator without digits cannot begin or run through one, so scanning from there
+// sees the same separators as scanning from the front. A separator with digits in it gets a single range.
+[[nodiscard]] static std::vector<size_t> range_starts(
+  const std::string_view text,
+  const std::string_view separator,
+  const unsigned         threads
+) {
+    std::vector<size_t> starts{0};
+    const size_t        count = std::min<size_t>(threads * ranges_per_thread, text.size() / range_min_chars);
+    if (count > 1 && std::ranges::none_of(separator, is_digit)) {
+        for (size_t r = 1; r < count; ++r) {
+            size_t pos = std::max(starts.back() + 1, text.size() / count * r);
+            while (pos < text.size() && !is_digit(text[pos])) {
+                ++pos;
+            }
+            if (pos < text.size()) {
+                starts.push_back(pos);
+            }
+        }
+    }
+    starts.push_back(text.size());
+    return starts;
+}
+
+// The block boundaries: bounds[b] is the first character of block b, counting blocks from the least
+// significant end, and bounds[blocks] is 0 so block b spans [bounds[b + 1], bounds[b]). Every block but the
+// most significant holds exactly block_digits digits. Returns nothing if a character is neither a digit nor
+// a separator, and no blocks if there are no digits.
+[[nodiscard]] static std::expected<std::vector<size_t>, errors::ParseError> block_bounds(
+  const std::string_view text,
+  const std::string_view separator,
+  const size_t           block_digits,
+  const unsigned         threads
+) {
+    if (separator.empty()) {
+        // the digits are the characters; the parser validates them as it converts
+        if (text.empty()) {
+            return std::vector<size_t>{};
+        }
+        std::vector<size_t> bounds{text.size()};
+        for (size_t end = text.size(); end > block_digits; end -= block_digits) {
+            bounds.push_back(end - block_digits);
+        }
+        bounds.push_back(0);
+        return bounds;
+    }
+
+    // count the digits of each range, validating them on the way
+    const std::vector<size_t> starts = range_starts(text, separator, threads);
+    const size_t              ranges = starts.size() - 1;
+    std::vector<size_t>       digits(ranges + 1);
+    parallel_for(ranges, threads, [&](const size_t r) {
+        size_t     count = 0;
+        const bool valid = for_each_digit(text.substr(starts[r], starts[r + 1] - starts[r]), separator, [&](size_t) {
+            ++count;
+        });
+        digits[r] = valid ? count : invalid_range;
+    });
+    if (std::ranges::find(digits, invalid_range) != digits.end()) {
+        return std::unexpected(errors::ParseError::InvalidCharacter);
+    }
+
+    // digits[r] becomes the index of the first digit of range r
+    size_t total = 0;
+    for (size_t &count : digits) {
+        total += std::exchange(count, total);
+    }
+    if (total == 0) {
+        return std::vector<size_t>{};
+    }
+
+    // block b > 0 ends just before digit total - b * block_digits; find where that digit sits
+    const size_t        blocks = (total + block_digits - 1) / block_digits;
+    std::vector<size_t> bounds(blocks + 1);
+    bounds[0]      = text.size();
+    bounds[blocks] = 0;
+    parallel_for(ranges, threads, [&](const size_t r) {
+        // the most significant block starting at or past the first digit of the range; the top block
+        // starts at 0 already
+        size_t block = std::min((total - digits[r]) / block_digits, blocks - 1);
+        size_t index = digits[r];
+        (void)for_each_digit(text.substr(starts[r], starts[r + 1] - starts[r]), separator, [&](const size_t pos) {
+            if (block > 0 && index == total - block * block_digits) {
+                bounds[block--] = starts[r] + pos;
+            }
+            ++index;
+        });
+    });
+    return bounds;
+}
+
+std::expected<big_int, errors::ParseError> parse_decimal_parallel(
+  const std::string_view input,
+  const bool             is_negative,
+  const std::string_view separator,
+  const unsigned         threads,
+  const size_t           block_level
+) {
+    const size_t block_digits = DEC_CHUNK_DIGITS << block_level;
+
+    const auto bounds = block_bounds(input, separator, block_digits, threads);
+    if (!bounds) {
+        return std::unexpected(bounds.error());
+    }
+    if (bounds->empty()) {
+        return std::unexpected(errors::ParseError::NoDigits);
+    }
+
+    // parse every block on its own; blocks with separators are compacted one at a time, never the input
+    std::vector<big_int> values(bounds->size() - 1);
+    std::atomic<bool>    invalid{false};
+    parallel_for(values.size(), threads, [&](const size_t b) {
+        std::string_view digits = input.substr((*bounds)[b + 1], (*bounds)[b] - (*bounds)[b + 1]);
+        std::string      compact;
+        if (!separator.empty()) {
+            compact.reserve(block_digits);
+            (void)for_each_digit(digits, separator, [&](const size_t pos) { compact.push_back(digits[pos]); });
+            digits = compact;
+        }
+
+        auto value = parse_limbs(digits, false);
+        if (!value) {
+            invalid = true;
+            return;
+        }
+        values[b] = std::move(*value);
+    });
+    if (invalid) {
+        return std::unexpected(errors::ParseError::InvalidCharacter);
+    }
+
+    // recombine neighbours as hi * 10^k + lo, one level of the tree at a time
+    for (size_t level = block_level; values.size() > 1; ++level) {
+        const big_int       &power = decimal_power_at(level, false).value;
+        std::vector<big_int> next((values.size() + 1) / 2);
+        parallel_for(next.size(), threads, [&](const size_t i) {
+            if (2 * i + 1 < values.size()) {
+                next[i] = values[2 * i + 1] * power;
+                next[i] += values[2 * i];
+            } else {
+                next[i] = std::move(values[2 * i]);
+            }
+        });
+        values = std::move(next);
+    }
+
+    big_int result = std::move(values.front());
+    if (is_negative && !result.is_zero()) {
+        big_int_access::impl(result).is_negative_ = true;
+    }
+    return result;
+}
+
+} // namespace arbys::bignum::detail
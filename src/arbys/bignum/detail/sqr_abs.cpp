@@ -0,0 +1,158 @@
+#include "arbys/bignum/big_int.h"
+#include "big_int_internal.h"
+#include "detail.h"
+#include <algorithm>
+#include <cassert>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace arbys::bignum::detail {
+
+// The symmetric schoolbook kernel does half the limb products of mul_basecase, so it stays ahead of
+// Karatsuba squaring for longer than mul_basecase stays ahead of Karatsuba
+constexpr size_t karatsuba_sqr_threshold = 48;
+
+// Squares evaluate only one operand, so their crossovers differ from the general products
+constexpr size_t toom3_sqr_threshold = 700;
+constexpr size_t toom4_sqr_threshold = 1700;
+
+// A square runs two transforms per prime instead of three, so the NTT pays off sooner than for
+// products; the limb width scales the threshold as for ntt_threshold in mul_abs.cpp
+constexpr size_t ntt_sqr_threshold = LIMB_BITS == 64 ? 12000 : 2500;
+
+void sqr_basecase(std::span<limb_t> out, std::span<const limb_t> x) noexcept {
+    const size_t n = x.size();
+
+    // off-diagonal products: out[1, 2n - 1) = sum of x[i] * x[j] * B^(i + j) over i < j
+    out[0]         = 0;
+    out[2 * n - 1] = 0;
+    if (n > 1) {
+        limb_t carry = 0;
+        for (size_t j = 1; j < n; ++j) {
+            const dlimb_t prod = dlimb_t{x[0]} * x[j] + carry;
+            out[j]             = static_cast<limb_t>(prod);
+            carry              = static_cast<limb_t>(prod >> LIMB_BITS);
+        }
+        out[n] = carry;
+
+        for (size_t i = 1; i + 1 < n; ++i) {
+            carry = 0;
+            for (size_t j = i + 1; j < n; ++j) {
+                const dlimb_t prod = dlimb_t{x[i]} * x[j] + out[i + j] + carry;
+                out[i + j]         = static_cast<limb_t>(prod);
+                carry              = static_cast<limb_t>(prod >> LIMB_BITS);
+            }
+            out[i + n] = carry;
+        }
+    }
+
+    // out = 2 * out + sum of x[i]^2 * B^(2i); the doubled off-diagonal part is below x^2, so nothing spills
+    limb_t shifted_out = 0;
+    limb_t carry       = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const dlimb_t square = dlimb_t{x[i]} * x[i];
+
+        const limb_t lo = out[2 * i];
+        const limb_t hi = out[2 * i + 1];
+
+        const dlimb_t low  = dlimb_t{static_cast<limb_t>(lo << 1 | shifted_out)} + static_cast<limb_t>(square) + carry;
+        const dlimb_t high = dlimb_t{static_cast<limb_t>(hi << 1 | lo >> (LIMB_BITS - 1))}
+                           + static_cast<limb_t>(square >> LIMB_BITS) + (low >> LIMB_BITS);
+
+        out[2 * i]     = static_cast<limb_t>(low);
+        out[2 * i + 1] = static_cast<limb_t>(high);
+        carry          = static_cast<limb_t>(high >> LIMB_BITS);
+        shifted_out    = hi >> (LIMB_BITS - 1);
+    }
+    assert(carry == 0 && shifted_out == 0);
+}
+
+size_t karatsuba_sqr_scratch_size(size_t n) noexcept {
+    // same layout as karatsuba_mul, with the second difference slot left unused
+    size_t size = 0;
+    while (n >= karatsuba_sqr_threshold) {
+        n = (n + 1) / 2;
+        size += 4 * n + 1;
+    }
+    return size;
+}
+
+void karatsuba_sqr(std::span<limb_t> out, std::span<const limb_t> x, std::span<limb_t> scratch) noexcept {
+    const size_t n = x.size();
+
+    if (n < karatsuba_sqr_threshold) {
+        sqr_basecase(out, x);
+        return;
+    }
+
+    // x = x1 * B^h + x0, x^2 = x0^2 + (x0^2 + x1^2 - (x0 - x1)^2) * B^h + x1^2 * B^2h
+    const size_t h  = (n + 1) / 2;
+    const auto   x0 = x.first(h);
+    const auto   x1 = x.subspan(h);
+
+    // scratch layout: [ |x0 - x1| : h ][ unused : h + 1 ][ vm1 : 2h ][ scratch for recursion ]
+    const auto diff = scratch.first(h);
+    const auto vm1  = scratch.subspan(2 * h + 1, 2 * h);
+    const auto rest = scratch.subspan(4 * h + 1);
+
+    if (cmp_limbs(x0, x1) < 0) {
+        std::fill(diff.begin(), diff.end(), limb_t{0});
+        std::ranges::copy(x1, diff.begin());
+        (void)sub_limbs(diff, diff, x0);
+    } else {
+        (void)sub_limbs(diff, x0, x1);
+    }
+
+    karatsuba_sqr(vm1, diff, rest);
+    karatsuba_sqr(out.first(2 * h), x0, rest);
+    karatsuba_sqr(out.subspan(2 * h), x1, rest);
+
+    // middle = x0^2 + x1^2 - (x0 - x1)^2 = 2 x0 x1, built over the dead difference
+    const auto middle = scratch.first(2 * h + 1);
+    middle[2 * h]     = add_limbs(middle.first(2 * h), out.first(2 * h), out.subspan(2 * h));
+    [[maybe_unused]] const limb_t borrow = sub_limbs(middle, middle, vm1);
+    assert(borrow == 0);
+
+    // out += middle * B^h; limbs of middle beyond the end of out are zero
+    const auto top = out.subspan(h);
+    [[maybe_unused]] const limb_t carry =
+      add_limbs(top, top, middle.first(std::min(middle.size(), top.size())));
+    assert(carry == 0);
+}
+
+void sqr_limbs(std::span<limb_t> out, std::span<const limb_t> x) {
+    const size_t n = x.size();
+
+    if (n < karatsuba_sqr_threshold) {
+        sqr_basecase(out, x);
+        return;
+    }
+    if (n >= ntt_sqr_threshold && 2 * n <= ntt_max_limbs) {
+        ntt_sqr(out, x);
+        return;
+    }
+    if (n >= toom4_sqr_threshold) {
+        toom4_sqr(out, x);
+        return;
+    }
+    if (n >= toom3_sqr_threshold) {
+        toom3_sqr(out, x);
+        return;
+    }
+
+    // one allocation up front; the recursion itself never allocates
+    std::vector<limb_t> scratch(karatsuba_sqr_scratch_size(n));
+    karatsuba_sqr(out, x, scratch);
+}
+
+big_int sqr_abs(const big_int_view x) {
+    const auto x_limbs = x.limbs();
+
+    limb_vector result_limbs(2 * x_limbs.size());
+    sqr_limbs(result_limbs, x_limbs);
+
+    return big_int_access::create(false, std::move(result_limbs));
+}
+
+} // namespace arbys::bignum::detail
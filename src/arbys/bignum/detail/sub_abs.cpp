@@ -1,5 +1,6 @@
 #include <cassert>
 #include <ranges>
+#include <span>
 
 #include "arbys/bignum/big_int.h"
 #include "big_int_internal.h"
@@ -7,46 +8,50 @@
 
 namespace arbys::bignum::detail {
 
+limb_t sub_limbs(std::span<limb_t> out, std::span<const limb_t> lhs, std::span<const limb_t> rhs) noexcept {
+    dlimb_t borrow = 0;
+
+    for (size_t i = 0; i < rhs.size(); ++i) {
+        const dlimb_t diff = dlimb_t{lhs[i]} - rhs[i] - borrow;
+        out[i]             = static_cast<limb_t>(diff);
+        borrow             = (diff >> LIMB_BITS) & 1;
+    }
+
+    for (size_t i = rhs.size(); i < lhs.size(); ++i) {
+        const dlimb_t diff = dlimb_t{lhs[i]} - borrow;
+        out[i]             = static_cast<limb_t>(diff);
+        borrow             = (diff >> LIMB_BITS) & 1;
+    }
+
+    return static_cast<limb_t>(borrow);
+}
+
 /// Subtracts the absolute values: |lhs| - |rhs|
 /// Precondition: |lhs| >= |rhs| (undefined behavior otherwise)
-big_int sub_abs(const big_int &lhs, const big_int &rhs) {
-    const auto &lhs_limbs = big_int_access::limbs(lhs);
-    const auto &rhs_limbs = big_int_access::limbs(rhs);
+big_int sub_abs(const big_int_view lhs, const big_int_view rhs) {
+    const auto lhs_limbs = lhs.limbs();
+    const auto rhs_limbs = rhs.limbs();
 
-    const size_t lhs_len = big_int_access::length(lhs);
-    const size_t rhs_len = big_int_access::length(rhs);
+    const size_t lhs_len = lhs_limbs.size();
+    const size_t rhs_len = rhs_limbs.size();
 
-    std::vector<limb_t> result;
+    limb_vector result;
     result.reserve(lhs_len);
 
-    s_dlimb_t borrow = 0;
+    dlimb_t borrow = 0;
 
-    // subtract common limbs
+    // subtract common limbs; a wrapped difference sets the bit above the limb
     for (size_t i = 0; i < rhs_len; ++i) {
-        s_dlimb_t diff = static_cast<s_dlimb_t>(lhs_limbs[i]) - static_cast<s_dlimb_t>(rhs_limbs[i]) - borrow;
-
-        if (diff < 0) {
-            diff += BASE;
-            borrow = 1;
-        } else {
-            borrow = 0;
-        }
-
+        const dlimb_t diff = dlimb_t{lhs_limbs[i]} - rhs_limbs[i] - borrow;
         result.push_back(static_cast<limb_t>(diff));
+        borrow = (diff >> LIMB_BITS) & 1;
     }
 
     // propagate borrow through remaining limbs
     for (size_t i = rhs_len; i < lhs_len; ++i) {
-        s_dlimb_t diff = static_cast<s_dlimb_t>(lhs_limbs[i]) - borrow;
-
-        if (diff < 0) {
-            diff += BASE;
-            borrow = 1;
-        } else {
-            borrow = 0;
-        }
-
+        const dlimb_t diff = dlimb_t{lhs_limbs[i]} - borrow;
         result.push_back(static_cast<limb_t>(diff));
+        borrow = (diff >> LIMB_BITS) & 1;
     }
 
     // borrow must be zero here
@@ -0,0 +1,268 @@
+#include "arbys/bignum/big_int.h"
+#include "big_int_internal.h"
+#include "detail.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace arbys::bignum::detail {
+
+// Below this many limbs peeling a limb-sized chunk of digits per pass beats another Barrett split
+constexpr size_t to_string_dc_threshold = 20;
+
+constexpr std::string_view digit_chars = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+// Base 10, known at compile time, with the powers cached for the lifetime of the program
+struct decimal_radix {
+    static constexpr unsigned base         = 10;
+    static constexpr size_t   chunk_digits = DEC_CHUNK_DIGITS;
+    static constexpr limb_t   chunk_base   = DEC_CHUNK_BASE;
+
+    static constexpr limb_divisor chunk_divisor = prepare_limb_divisor(DEC_CHUNK_BASE);
+
+    static const radix_power &power(const size_t k) { return decimal_power_at(k, true); }
+};
+
+// Any other base; the powers base^(chunk_digits * 2^k) are built by squaring for one conversion.
+// write_padded asks for the top level first, so the table only grows before any reference into it is held.
+class runtime_radix {
+  public:
+    explicit runtime_radix(const unsigned base) noexcept
+        : base(base),
+          chunk_digits(chunk_for_base(base).digits),
+          chunk_base(chunk_for_base(base).value),
+          chunk_divisor(prepare_limb_divisor(chunk_base)) {}
+
+    const radix_power &power(const size_t k) {
+        while (powers_.size() <= k) {
+            if (powers_.empty()) {
+                powers_.push_back({big_int_access::create_abs({chunk_base}), big_int(), chunk_digits});
+            } else {
+                const radix_power &previous = powers_.back();
+                powers_.push_back({previous.value.square(), big_int(), 2 * previous.digits});
+            }
+        }
+
+        radix_power &power = powers_[k];
+        if (power.reciprocal.is_zero()) {
+            power.reciprocal = reciprocal_abs(power.value);
+        }
+        return power;
+    }
+
+    const unsigned base;
+    const size_t   chunk_digits;
+    const limb_t   chunk_base;
+
+    const limb_divisor chunk_divisor;
+
+  private:
+    std::vector<radix_power> powers_;
+};
+
+// Writes the chunk_digits digits of value, zero-padded, ending just before end
+template <class Radix> static void write_chunk(char *end, limb_t value, const Radix &radix) noexcept {
+    for (size_t i = 0; i < radix.chunk_digits; ++i) {
+        *--end = digit_chars[value % radix.base];
+        value /= radix.base;
+    }
+}
+
+// out[0, digits) = x, zero-padded; one pass over the limbs per chunk_digits digits
+// Precondition: x < base^digits, digits a multiple of chunk_digits; x.size() < to_string_dc_threshold
+template <class Radix>
+static void write_basecase(std::span<const limb_t> x, char *out, const size_t digits, const Radix &radix) noexcept {
+    std::array<limb_t, to_string_dc_threshold> rest;
+    std::ranges::copy(x, rest.begin());
+    size_t length = x.size();
+    char  *end    = out + digits;
+
+    while (length > 0 && rest[length - 1] == 0) {
+        --length;
+    }
+    while (length > 0) {
+        const std::span<limb_t> live(rest.data(), length);
+        write_chunk(end, divmod_limb(live, live, radix.chunk_divisor), radix);
+        end -= radix.chunk_digits;
+
+        while (length > 0 && rest[length - 1] == 0) {
+            --length;
+        }
+    }
+    std::fill(out, end, '0');
+}
+
+// out[0, 2 * radix.power(level).digits) = x, zero-padded, splitting by that power until the halves are
+// small enough for the basecase
+// Precondition: x < base^(2 * radix.power(level).digits)
+template <class Radix> static void write_padded(const big_int_view x, char *out, const size_t level, Radix &radix) {
+    const size_t digits = radix.chunk_digits << (level + 1);
+
+    if (level == 0 || x.limbs().size() < to_string_dc_threshold) {
+        write_basecase(x.limbs(), out, digits, radix);
+        return;
+    }
+
+    const radix_power   &power  = radix.power(level);
+    const DivisionResult halves = div_mod_barrett(x, power.value, power.reciprocal);
+
+    write_padded(halves.quotient, out, level - 1, radix);
+    write_padded(halves.remainder, out + digits / 2, level - 1, radix);
+}
+
+// Most characters the basecase writes, padding to whole chunks included: fewer than one digit per bit
+constexpr size_t basecase_max_chars = (to_string_dc_threshold + 1) * LIMB_BITS;
+
+// Moves the digits in [begin, end) after the zero padding to first; nullptr if they do not fit before last
+// [begin, end) may overlap the destination
+static char *move_significant(const char *begin, const char *end, char *first, const char *last) noexcept {
+    while (*begin == '0') {
+        ++begin;
+    }
+    const auto count = static_cast<size_t>(end - begin);
+    if (count > static_cast<size_t>(last - first)) {
+        return nullptr;
+    }
+    std::memmove(first, begin, count);
+    return first + count;
+}
+
+// Characters write_radix needs in front of it to work without a scratch buffer
+template <class Radix>
+static size_t padded_size(const big_int_view x, const size_t bound, const Radix &radix) noexcept {
+    if (x.limbs().size() < to_string_dc_threshold) {
+        return bound;
+    }
+    size_t level = 0;
+    while ((radix.chunk_digits << (level + 1)) < bound) {
+        ++level;
+    }
+    return radix.chunk_digits << (level + 1);
+}
+
+// Precondition: x != 0, bound = digits_bound(x, radix.base)
+template <class Radix>
+static char *write_radix(char *first, char *last, const big_int_view x, const size_t bound, Radix &radix) {
+    const auto limbs = x.limbs();
+
+    if (limbs.size() < to_string_dc_threshold) {
+        std::array<char, basecase_max_chars> buffer;
+        const size_t digits = (bound + radix.chunk_digits - 1) / radix.chunk_digits * radix.chunk_digits;
+        write_basecase(limbs, buffer.data(), digits, radix);
+        return move_significant(buffer.data(), buffer.data() + digits, first, last);
+    }
+
+    size_t level = 0;
+    while ((radix.chunk_digits << (level + 1)) < bound) {
+        ++level;
+    }
+    const size_t padded = radix.chunk_digits << (level + 1);
+
+    // the padding goes in front of the digits, so a buffer short of it takes a detour through scratch
+    std::string scratch;
+    char       *out = first;
+    if (static_cast<size_t>(last - first) < padded) {
+        scratch.resize(padded);
+        out = scratch.data();
+    }
+
+    // the Barrett splits work on magnitudes
+    write_padded(x.abs(), out, level, radix);
+    return move_significant(out, out + padded, first, last);
+}
+
+// Power-of-two bases: every digit is a fixed run of bits, read off from the least significant end;
+// the digits of limbs end just before end
+static void write_bits(
+  char                   *end,
+  const size_t            digits,
+  std::span<const limb_t> limbs,
+  const unsigned          bits_per_digit
+) noexcept {
+    const dlimb_t mask = (dlimb_t{1} << bits_per_digit) - 1;
+
+    dlimb_t  window      = 0;
+    unsigned window_bits = 0;
+    size_t   next        = 0;
+    for (size_t i = 0; i < digits; ++i) {
+        if (window_bits < bits_per_digit) {
+            // past the top limb the missing bits are zeros
+            if (next < limbs.size()) {
+                window |= dlimb_t{limbs[next++]} << window_bits;
+            }
+            window_bits += LIMB_BITS;
+        }
+        *--end = digit_chars[static_cast<size_t>(window & mask)];
+        window >>= bits_per_digit;
+        window_bits -= bits_per_digit;
+    }
+}
+
+size_t digits_bound(const big_int_view x, const unsigned base) noexcept {
+    if (x.is_zero()) {
+        return 1;
+    }
+    const auto   limbs = x.limbs();
+    const size_t bits  = (limbs.size() - 1) * LIMB_BITS + std::bit_width(limbs.back());
+
+    if (std::has_single_bit(base)) {
+        const auto bits_per_digit = static_cast<size_t>(std::countr_zero(base));
+        return (bits + bits_per_digit - 1) / bits_per_digit;
+    }
+    // x < 2^bits, so it has at most floor(bits / log2(base)) + 1 digits; decimal skips the log2 call
+    const double digits_per_bit = base == 10 ? 0.30102999566398120 : 1.0 / std::log2(base);
+    return static_cast<size_t>(static_cast<double>(bits) * digits_per_bit) + 1;
+}
+
+char *write_digits(char *first, char *last, const big_int_view x, const unsigned base) {
+    const size_t bound = digits_bound(x, base);
+
+    if (x.is_zero()) {
+        if (first == last) {
+            return nullptr;
+        }
+        *first = '0';
+        return first + 1;
+    }
+
+    if (std::has_single_bit(base)) {
+        if (bound > static_cast<size_t>(last - first)) {
+            return nullptr;
+        }
+        write_bits(first + bound, bound, x.limbs(), static_cast<unsigned>(std::countr_zero(base)));
+        return first + bound;
+    }
+
+    if (base == 10) {
+        decimal_radix radix;
+        return write_radix(first, last, x, bound, radix);
+    }
+    runtime_radix radix(base);
+    return write_radix(first, last, x, bound, radix);
+}
+
+void append_digits(std::string &out, const big_int_view x, const unsigned base) {
+    const size_t bound = digits_bound(x, base);
+
+    // room for the padding of the divide-and-conquer split, so the digits are written in place
+    size_t room = bound;
+    if (base == 10) {
+        room = padded_size(x, bound, decimal_radix{});
+    } else if (!std::has_single_bit(base)) {
+        room = padded_size(x, bound, runtime_radix(base));
+    }
+
+    const size_t start = out.size();
+    out.resize(start + room);
+    const char *end = write_digits(out.data() + start, out.data() + out.size(), x, base);
+    out.resize(static_cast<size_t>(end - out.data()));
+}
+
+} // namespace arbys::bignum::detail
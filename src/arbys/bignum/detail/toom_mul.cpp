@@ -0,0 +1,418 @@
+#include "arbys/bignum/big_int.h"
+#include "big_int_internal.h"
+#include "detail.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <initializer_list>
+#include <span>
+#include <vector>
+
+namespace arbys::bignum::detail {
+
+// Toom-Cook splits both operands into k-limb parts, evaluates the part polynomials at a few small points,
+// multiplies pointwise through mul_limbs / sqr_limbs (which recurse into whichever tier fits) and interpolates.
+// Intermediate values are kept as trimmed limb vectors. Every interpolation step is arranged so that
+// it only ever produces a non-negative value; signed evaluations (at -1, -2) carry a separate sign flag.
+
+namespace {
+
+using nat = std::vector<limb_t>;
+
+void trim(nat &x) noexcept {
+    while (!x.empty() && x.back() == 0) {
+        x.pop_back();
+    }
+}
+
+[[nodiscard]] std::span<const limb_t> trimmed(std::span<const limb_t> x) noexcept {
+    while (!x.empty() && x.back() == 0) {
+        x = x.first(x.size() - 1);
+    }
+    return x;
+}
+
+[[nodiscard]] nat to_nat(std::span<const limb_t> x) {
+    x = trimmed(x);
+    return nat(x.begin(), x.end());
+}
+
+// x += y
+void add_in(nat &x, std::span<const limb_t> y) {
+    y = trimmed(y);
+    if (x.size() < y.size()) {
+        x.resize(y.size(), 0);
+    }
+    if (const limb_t carry = add_limbs(x, x, y)) {
+        x.push_back(carry);
+    }
+}
+
+// x -= y, requires x >= y
+void sub_in(nat &x, std::span<const limb_t> y) {
+    y = trimmed(y);
+    assert(x.size() >= y.size());
+    [[maybe_unused]] const limb_t borrow = sub_limbs(x, x, y);
+    assert(borrow == 0);
+    trim(x);
+}
+
+// x += (negative ? -y : y), for callers that know the result is non-negative
+void add_signed(nat &x, const nat &y, const bool negative) {
+    if (negative) {
+        sub_in(x, y);
+    } else {
+        add_in(x, y);
+    }
+}
+
+// out = |x - y|, returns true when x < y
+bool sub_signed(nat &out, std::span<const limb_t> x, std::span<const limb_t> y) {
+    const bool negative = cmp_limbs(x, y) < 0;
+    out                 = to_nat(negative ? y : x);
+    sub_in(out, negative ? x : y);
+    return negative;
+}
+
+// x *= m
+void mul_1(nat &x, const limb_t m) {
+    dlimb_t carry = 0;
+    for (limb_t &limb : x) {
+        const dlimb_t prod = dlimb_t{limb} * m + carry;
+        limb               = static_cast<limb_t>(prod);
+        carry              = prod >> LIMB_BITS;
+    }
+    if (carry) {
+        x.push_back(static_cast<limb_t>(carry));
+    }
+}
+
+// x /= d for odd d known to divide x
+void divexact_1(nat &x, const limb_t d) noexcept {
+    assert(d % 2 == 1);
+    [[maybe_unused]] const limb_t borrow = divexact_limb(x, x, d);
+    assert(borrow == 0);
+    trim(x);
+}
+
+// x >>= bits, where the shifted-out bits are known to be zero
+void shr_exact(nat &x, const unsigned bits) noexcept {
+    assert(bits > 0 && bits < LIMB_BITS);
+    for (size_t i = 0; i < x.size(); ++i) {
+        x[i] >>= bits;
+        if (i + 1 < x.size()) {
+            x[i] |= x[i + 1] << (LIMB_BITS - bits);
+        }
+    }
+    trim(x);
+}
+
+[[nodiscard]] nat mul(std::span<const limb_t> lhs, std::span<const limb_t> rhs) {
+    lhs = trimmed(lhs);
+    rhs = trimmed(rhs);
+    if (lhs.empty() || rhs.empty()) {
+        return {};
+    }
+    nat result(lhs.size() + rhs.size());
+    mul_limbs(result, lhs, rhs);
+    trim(result);
+    return result;
+}
+
+[[nodiscard]] nat sqr(std::span<const limb_t> x) {
+    x = trimmed(x);
+    if (x.empty()) {
+        return {};
+    }
+    nat result(2 * x.size());
+    sqr_limbs(result, x);
+    trim(result);
+    return result;
+}
+
+// Splits x into N parts of k limbs (the last ones may be short or empty)
+template <size_t N> [[nodiscard]] std::array<std::span<const limb_t>, N> split(std::span<const limb_t> x, const size_t k) {
+    std::array<std::span<const limb_t>, N> parts{};
+    for (size_t i = 0; i < N; ++i) {
+        const size_t start = std::min(i * k, x.size());
+        const size_t len   = (i + 1 == N) ? x.size() - start : std::min(k, x.size() - start);
+        parts[i]           = x.subspan(start, len);
+    }
+    return parts;
+}
+
+// out = sum(coefficients[i] * B^(i * k))
+void assemble(std::span<limb_t> out, const size_t k, std::initializer_list<const nat *> coefficients) noexcept {
+    std::ranges::fill(out, limb_t{0});
+    size_t offset = 0;
+    for (const nat *c : coefficients) {
+        if (!c->empty()) {
+            const auto window = out.subspan(offset);
+            assert(window.size() >= c->size());
+            [[maybe_unused]] const limb_t carry = add_limbs(window, window, *c);
+            assert(carry == 0);
+        }
+        offset += k;
+    }
+}
+
+struct toom3_points {
+    nat  at_1, at_m1, at_2;
+    bool m1_negative = false;
+};
+
+// Evaluates a0 + a1 x + a2 x^2 at 1, -1 and 2
+[[nodiscard]] toom3_points evaluate3(const std::array<std::span<const limb_t>, 3> &a) {
+    toom3_points p;
+
+    nat even = to_nat(a[0]);
+    add_in(even, a[2]);
+
+    p.at_1 = even;
+    add_in(p.at_1, a[1]);
+    p.m1_negative = sub_signed(p.at_m1, even, a[1]);
+
+    // Horner: (2 a2 + a1) * 2 + a0
+    p.at_2 = to_nat(a[2]);
+    mul_1(p.at_2, 2);
+    add_in(p.at_2, a[1]);
+    mul_1(p.at_2, 2);
+    add_in(p.at_2, a[0]);
+
+    return p;
+}
+
+// Recovers c0..c4 of the product polynomial from its values at 0, 1, -1, 2 and infinity
+void interpolate3(
+  std::span<limb_t> out,
+  const size_t      k,
+  const nat        &v0,
+  const nat        &v1,
+  const nat        &vm1,
+  const bool        vm1_negative,
+  const nat        &v2,
+  const nat        &vinf
+) {
+    // even = (v1 + vm1) / 2 = c0 + c2 + c4, odd = (v1 - vm1) / 2 = c1 + c3
+    nat c2 = v1;
+    add_signed(c2, vm1, vm1_negative);
+    shr_exact(c2, 1);
+    nat odd = v1;
+    add_signed(odd, vm1, !vm1_negative);
+    shr_exact(odd, 1);
+
+    sub_in(c2, v0);
+    sub_in(c2, vinf);
+
+    // c3 = (v2 - c0 - 4 c2 - 16 c4 - 2 (c1 + c3)) / 6
+    nat c3 = v2;
+    sub_in(c3, v0);
+    nat t = c2;
+    mul_1(t, 4);
+    sub_in(c3, t);
+    t = vinf;
+    mul_1(t, 16);
+    sub_in(c3, t);
+    t = odd;
+    mul_1(t, 2);
+    sub_in(c3, t);
+    shr_exact(c3, 1);
+    divexact_1(c3, 3);
+
+    nat c1 = odd;
+    sub_in(c1, c3);
+
+    assemble(out, k, {&v0, &c1, &c2, &c3, &vinf});
+}
+
+struct toom4_points {
+    nat  at_1, at_m1, at_2, at_m2, at_half;
+    bool m1_negative = false;
+    bool m2_negative = false;
+};
+
+// Evaluates a0 + a1 x + a2 x^2 + a3 x^3 at 1, -1, 2, -2 and (scaled by 8) at 1/2
+[[nodiscard]] toom4_points evaluate4(const std::array<std::span<const limb_t>, 4> &a) {
+    toom4_points p;
+
+    nat even = to_nat(a[0]);
+    add_in(even, a[2]);
+    nat odd = to_nat(a[1]);
+    add_in(odd, a[3]);
+    p.at_1 = even;
+    add_in(p.at_1, odd);
+    p.m1_negative = sub_signed(p.at_m1, even, odd);
+
+    // even = a0 + 4 a2, odd = 2 a1 + 8 a3
+    even = to_nat(a[2]);
+    mul_1(even, 4);
+    add_in(even, a[0]);
+    odd = to_nat(a[3]);
+    mul_1(odd, 4);
+    add_in(odd, a[1]);
+    mul_1(odd, 2);
+    p.at_2 = even;
+    add_in(p.at_2, odd);
+    p.m2_negative = sub_signed(p.at_m2, even, odd);
+
+    // 8 a0 + 4 a1 + 2 a2 + a3
+    p.at_half = to_nat(a[0]);
+    for (size_t i = 1; i < 4; ++i) {
+        mul_1(p.at_half, 2);
+        add_in(p.at_half, a[i]);
+    }
+
+    return p;
+}
+
+// Recovers c0..c6 from the values at 0, 1, -1, 2, -2, 1/2 (scaled by 64) and infinity
+void interpolate4(
+  std::span<limb_t> out,
+  const size_t      k,
+  const nat        &v0,
+  const nat        &v1,
+  const nat        &vm1,
+  const bool        vm1_negative,
+  const nat        &v2,
+  const nat        &vm2,
+  const bool        vm2_negative,
+  const nat        &vhalf,
+  const nat        &vinf
+) {
+    // e1 = (v1 + vm1) / 2 - c0 - c6 = c2 + c4,  o1 = (v1 - vm1) / 2 = c1 + c3 + c5
+    nat e1 = v1;
+    add_signed(e1, vm1, vm1_negative);
+    shr_exact(e1, 1);
+    sub_in(e1, v0);
+    sub_in(e1, vinf);
+    nat o1 = v1;
+    add_signed(o1, vm1, !vm1_negative);
+    shr_exact(o1, 1);
+
+    // e2 = ((v2 + vm2) / 2 - c0 - 64 c6) / 4 = c2 + 4 c4,  o2 = (v2 - vm2) / 4 = c1 + 4 c3 + 16 c5
+    nat e2 = v2;
+    add_signed(e2, vm2, vm2_negative);
+    shr_exact(e2, 1);
+    sub_in(e2, v0);
+    nat t = vinf;
+    mul_1(t, 64);
+    sub_in(e2, t);
+    shr_exact(e2, 2);
+    nat o2 = v2;
+    add_signed(o2, vm2, !vm2_negative);
+    shr_exact(o2, 2);
+
+    nat c4 = e2;
+    sub_in(c4, e1);
+    divexact_1(c4, 3);
+    nat c2 = e1;
+    sub_in(c2, c4);
+
+    // w = (vhalf - 64 c0 - 16 c2 - 4 c4 - c6) / 2 = 16 c1 + 4 c3 + c5
+    nat w = vhalf;
+    t     = v0;
+    mul_1(t, 64);
+    sub_in(w, t);
+    t = c2;
+    mul_1(t, 16);
+    sub_in(w, t);
+    t = c4;
+    mul_1(t, 4);
+    sub_in(w, t);
+    sub_in(w, vinf);
+    shr_exact(w, 1);
+
+    // x = (o2 - o1) / 3 = c3 + 5 c5,  y = (16 o1 - w) / 3 = 4 c3 + 5 c5
+    nat x = o2;
+    sub_in(x, o1);
+    divexact_1(x, 3);
+    nat y = o1;
+    mul_1(y, 16);
+    sub_in(y, w);
+    divexact_1(y, 3);
+
+    nat c3 = y;
+    sub_in(c3, x);
+    divexact_1(c3, 3);
+    nat c5 = x;
+    sub_in(c5, c3);
+    divexact_1(c5, 5);
+    nat c1 = o1;
+    sub_in(c1, c3);
+    sub_in(c1, c5);
+
+    assemble(out, k, {&v0, &c1, &c2, &c3, &c4, &c5, &vinf});
+}
+
+} // namespace
+
+void toom3_mul(std::span<limb_t> out, std::span<const limb_t> lhs, std::span<const limb_t> rhs) {
+    const size_t k = (std::max(lhs.size(), rhs.size()) + 2) / 3;
+    const auto   a = split<3>(lhs, k);
+    const auto   b = split<3>(rhs, k);
+
+    const toom3_points pa = evaluate3(a);
+    const toom3_points pb = evaluate3(b);
+
+    const nat v0   = mul(a[0], b[0]);
+    const nat v1   = mul(pa.at_1, pb.at_1);
+    const nat vm1  = mul(pa.at_m1, pb.at_m1);
+    const nat v2   = mul(pa.at_2, pb.at_2);
+    const nat vinf = mul(a[2], b[2]);
+
+    interpolate3(out, k, v0, v1, vm1, pa.m1_negative != pb.m1_negative, v2, vinf);
+}
+
+void toom3_sqr(std::span<limb_t> out, std::span<const limb_t> x) {
+    const size_t k = (x.size() + 2) / 3;
+    const auto   a = split<3>(x, k);
+
+    const toom3_points pa = evaluate3(a);
+
+    interpolate3(out, k, sqr(a[0]), sqr(pa.at_1), sqr(pa.at_m1), false, sqr(pa.at_2), sqr(a[2]));
+}
+
+void toom4_mul(std::span<limb_t> out, std::span<const limb_t> lhs, std::span<const limb_t> rhs) {
+    const size_t k = (std::max(lhs.size(), rhs.size()) + 3) / 4;
+    const auto   a = split<4>(lhs, k);
+    const auto   b = split<4>(rhs, k);
+
+    const toom4_points pa = evaluate4(a);
+    const toom4_points pb = evaluate4(b);
+
+    const nat v0    = mul(a[0], b[0]);
+    const nat v1    = mul(pa.at_1, pb.at_1);
+    const nat vm1   = mul(pa.at_m1, pb.at_m1);
+    const nat v2    = mul(pa.at_2, pb.at_2);
+    const nat vm2   = mul(pa.at_m2, pb.at_m2);
+    const nat vhalf = mul(pa.at_half, pb.at_half);
+    const nat vinf  = mul(a[3], b[3]);
+
+    interpolate4(
+      out, k, v0, v1, vm1, pa.m1_negative != pb.m1_negative, v2, vm2, pa.m2_negative != pb.m2_negative, vhalf, vinf
+    );
+}
+
+void toom4_sqr(std::span<limb_t> out, std::span<const limb_t> x) {
+    const size_t k = (x.size() + 3) / 4;
+    const auto   a = split<4>(x, k);
+
+    const toom4_points pa = evaluate4(a);
+
+    interpolate4(
+      out,
+      k,
+      sqr(a[0]),
+      sqr(pa.at_1),
+      sqr(pa.at_m1),
+      false,
+      sqr(pa.at_2),
+      sqr(pa.at_m2),
+      false,
+      sqr(pa.at_half),
+      sqr(a[3])
+    );
+}
+
+} // namespace arbys::bignum::detail
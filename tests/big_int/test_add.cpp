@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <limits>
+
 #include "../../include/arbys/bignum/big_int.h"
 #include "../helpers/helpers.h"
 
@@ -109,4 +111,55 @@ TEST(BigIntAdd, RandomizedLarge) {
     }
 }
 
+TEST(BigIntAdd, CarryAcrossLimbBoundaries) {
+    // 2^64 - 1 and 2^128 - 1 are all-ones limbs for both 32- and 64-bit limbs
+    const big_int a = std::numeric_limits<unsigned long long>::max();
+    EXPECT_BI_EQ(a + big_int(1), "18446744073709551616");
+
+    const big_int b = big_int::from_string("340282366920938463463374607431768211455").value();
+    EXPECT_BI_EQ(b + big_int(1), "340282366920938463463374607431768211456");
+}
+
+TEST(BigIntAdd, CompoundAssign) {
+    big_int a = big_int::from_string("18446744073709551615").value();
+    a += big_int(1);
+    EXPECT_BI_EQ(a, "18446744073709551616");
+
+    a += big_int::from_string("-18446744073709551617").value();
+    EXPECT_BI_EQ(a, "-1");
+
+    a += big_int(1);
+    EXPECT_BI_EQ(a, "0");
+    EXPECT_FALSE(a.is_negative());
+
+    big_int b = big_int::from_string("-340282366920938463463374607431768211455").value();
+    (b += b) += big_int(-2);
+    EXPECT_BI_EQ(b, "-680564733841876926926749214863536422912");
+}
+
+TEST(BigIntAdd, RvalueOperands) {
+    const big_int a = big_int::from_string("123456789012345678901234567890").value();
+    const big_int b = big_int::from_string("-987654321098765432109876543210").value();
+
+    EXPECT_BI_EQ(big_int(a) + b, "-864197532086419753208641975320");
+    EXPECT_BI_EQ(a + big_int(b), "-864197532086419753208641975320");
+    EXPECT_BI_EQ(big_int(a) + big_int(b), "-864197532086419753208641975320");
+    EXPECT_BI_EQ(a + b + a + b, "-1728395064172839506417283950640");
+}
+
+TEST(BigIntAdd, AccumulateMatchesAdd) {
+    std::uint64_t seed = 900;
+    big_int       sum;
+    big_int       expected;
+    for (int i = 0; i < 50; ++i) {
+        big_int term = helpers::random_big_int(1 + i % 7, seed++);
+        if (i % 3 == 0) {
+            term = -term;
+        }
+        sum += term;
+        expected = expected.add(term);
+        EXPECT_BI_EQ(sum, expected);
+    }
+}
+
 } // namespace arbys::bignumbers::tests
@@ -0,0 +1,131 @@
+#include "arbys/bignum/big_int.h"
+#include "arbys/bignum/errors.h"
+
+#include "../helpers/helpers.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <initializer_list>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace arbys::bignum::tests {
+
+class BigIntBytesTest : public ::testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static std::vector<std::byte> bytes(const std::initializer_list<unsigned> values) {
+        std::vector<std::byte> out;
+        for (const unsigned v : values) {
+            out.push_back(static_cast<std::byte>(v));
+        }
+        return out;
+    }
+};
+
+TEST_F(BigIntBytesTest, TwosComplementKnownValues) {
+    EXPECT_EQ(big_int().to_bytes(), bytes({0x00}));
+    EXPECT_EQ(big_int(127).to_bytes(), bytes({0x7f}));
+    EXPECT_EQ(big_int(128).to_bytes(), bytes({0x00, 0x80}));
+    EXPECT_EQ(big_int(-1).to_bytes(), bytes({0xff}));
+    EXPECT_EQ(big_int(-128).to_bytes(), bytes({0x80}));
+    EXPECT_EQ(big_int(-129).to_bytes(), bytes({0xff, 0x7f}));
+    EXPECT_EQ(big_int(-256).to_bytes(), bytes({0xff, 0x00}));
+    EXPECT_EQ(big_int(0x01020304).to_bytes(std::endian::little), bytes({0x04, 0x03, 0x02, 0x01}));
+
+    EXPECT_BI_EQ(big_int::from_bytes(bytes({0xff, 0x7f})), -129);
+    EXPECT_BI_EQ(big_int::from_bytes(bytes({0x80})), -128);
+    EXPECT_BI_EQ(big_int::from_bytes(bytes({0x00, 0x80}), std::endian::little), -32768);
+    EXPECT_BI_EQ(big_int::from_bytes({}), big_int());
+}
+
+TEST_F(BigIntBytesTest, SignMagnitudeKnownValues) {
+    constexpr auto sm = byte_encoding::sign_magnitude;
+    EXPECT_EQ(big_int(127).to_bytes(std::endian::big, sm), bytes({0x7f}));
+    EXPECT_EQ(big_int(-127).to_bytes(std::endian::big, sm), bytes({0xff}));
+    EXPECT_EQ(big_int(-128).to_bytes(std::endian::big, sm), bytes({0x80, 0x80}));
+    EXPECT_EQ(big_int(-1).to_bytes(std::endian::little, sm), bytes({0x81}));
+
+    EXPECT_BI_EQ(big_int::from_bytes(bytes({0x80, 0x80}), std::endian::big, sm), -128);
+    // negative zero reads as zero
+    EXPECT_BI_EQ(big_int::from_bytes(bytes({0x80, 0x00}), std::endian::big, sm), big_int());
+    EXPECT_FALSE(big_int::from_bytes(bytes({0x80}), std::endian::big, sm).is_negative());
+}
+
+TEST_F(BigIntBytesTest, FixedWidthPads) {
+    EXPECT_EQ(big_int(-2).to_bytes(4).value(), bytes({0xff, 0xff, 0xff, 0xfe}));
+    EXPECT_EQ(big_int(258).to_bytes(4, std::endian::little).value(), bytes({0x02, 0x01, 0x00, 0x00}));
+    EXPECT_EQ(
+      big_int(-2).to_bytes(3, std::endian::big, byte_encoding::sign_magnitude).value(),
+      bytes({0x80, 0x00, 0x02})
+    );
+
+    helpers::expect_err(big_int(128).to_bytes(1), errors::ArithmeticError::Overflow);
+    helpers::expect_err(big_int(-129).to_bytes(1), errors::ArithmeticError::Overflow);
+    helpers::expect_err(big_int(-128).to_bytes(1, std::endian::big, byte_encoding::sign_magnitude), errors::ArithmeticError::Overflow);
+    helpers::expect_ok(big_int(-128).to_bytes(1));
+}
+
+TEST_F(BigIntBytesTest, SpanOverloadFillsTheSpan) {
+    std::vector<std::byte> out(8, std::byte{0x55});
+    ASSERT_TRUE(big_int(-3).to_bytes(std::span(out), std::endian::little).has_value());
+    EXPECT_EQ(out, bytes({0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff}));
+
+    // too small: reported, and the span is left alone
+    std::vector<std::byte> small(1, std::byte{0x55});
+    helpers::expect_err(big_int(1000).to_bytes(std::span(small)), errors::ArithmeticError::Overflow);
+    EXPECT_EQ(small, bytes({0x55}));
+}
+
+TEST_F(BigIntBytesTest, MatchesNativeIntegers) {
+    for (const long long v : {0LL, 1LL, -1LL, 255LL, -255LL, 65536LL, -65536LL, 0x7fffffffffffffffLL, -0x7fffffffffffffffLL - 1}) {
+        const std::vector<std::byte> le = big_int(v).to_bytes(8, std::endian::little).value();
+        long long                    back = 0;
+        std::copy(le.begin(), le.end(), reinterpret_cast<std::byte *>(&back));
+        if constexpr (std::endian::native == std::endian::little) {
+            EXPECT_EQ(back, v);
+        }
+        EXPECT_BI_EQ(big_int::from_bytes(le, std::endian::little), v);
+    }
+}
+
+TEST_F(BigIntBytesTest, RoundTrips) {
+    // limb-aligned and unaligned byte counts, inline and spilled storage, both orders and encodings
+    std::uint64_t seed = 2000;
+    for (const size_t limbs : {1, 2, 3, 4, 5, 17, 300}) {
+        const big_int magnitude = helpers::random_big_int(limbs, seed++);
+        for (const big_int &a : {magnitude, -magnitude, magnitude + 1, -(magnitude / 8)}) {
+            for (const auto order : {std::endian::little, std::endian::big}) {
+                for (const auto encoding : {byte_encoding::twos_complement, byte_encoding::sign_magnitude}) {
+                    const std::vector<std::byte> out = a.to_bytes(order, encoding);
+                    EXPECT_EQ(out.size(), a.byte_size(encoding));
+                    EXPECT_BI_EQ(big_int::from_bytes(out, order, encoding), a);
+
+                    const auto wide = a.to_bytes(out.size() + 5, order, encoding).value();
+                    EXPECT_BI_EQ(big_int::from_bytes(wide, order, encoding), a);
+                    helpers::expect_err(a.to_bytes(out.size() - 1, order, encoding), errors::ArithmeticError::Overflow);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(BigIntBytesTest, PowersOfTwoAtByteBoundaries) {
+    // -2^(8n - 1) is the one negative value that fits the same bytes as 2^(8n - 1) - 1
+    for (const int n : {1, 2, 4, 8, 9, 16, 33}) {
+        const big_int top = big_int::from_string("8" + std::string(2 * n - 1, '0'), 16).value();
+        EXPECT_EQ((-top).byte_size(), static_cast<size_t>(n));
+        EXPECT_EQ(top.byte_size(), static_cast<size_t>(n + 1));
+        EXPECT_EQ((top - 1).byte_size(), static_cast<size_t>(n));
+        EXPECT_EQ((-top - 1).byte_size(), static_cast<size_t>(n + 1));
+        EXPECT_BI_EQ(big_int::from_bytes((-top).to_bytes()), -top);
+    }
+}
+
+} // namespace arbys::bignum::tests
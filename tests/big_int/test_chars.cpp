@@ -0,0 +1,129 @@
+#include "arbys/bignum/big_int.h"
+#include "arbys/bignum/format.h"
+
+#include "../helpers/helpers.h"
+
+#include <gtest/gtest.h>
+
+#include <charconv>
+#include <format>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace arbys::bignum::tests {
+
+class BigIntCharsTest : public ::testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+
+    // to_chars into a buffer of exactly the given size; nothing is returned past the written characters
+    static std::string to_chars_sized(const big_int &a, const size_t size, const int base, std::errc &ec) {
+        std::vector<char>          buffer(size);
+        const std::to_chars_result result = a.to_chars(buffer.data(), buffer.data() + buffer.size(), base);
+        ec                                = result.ec;
+        return ec == std::errc{} ? std::string(buffer.data(), result.ptr) : std::string();
+    }
+};
+
+TEST_F(BigIntCharsTest, ToCharsWritesTheDigits) {
+    char buffer[64];
+
+    const auto result = big_int(-255).to_chars(buffer, buffer + sizeof buffer);
+    EXPECT_EQ(result.ec, std::errc{});
+    EXPECT_EQ(std::string_view(buffer, result.ptr), "-255");
+
+    const auto hex = big_int(-255).to_chars(buffer, buffer + sizeof buffer, 16);
+    EXPECT_EQ(std::string_view(buffer, hex.ptr), "-ff");
+
+    const auto zero = big_int().to_chars(buffer, buffer + 1);
+    EXPECT_EQ(zero.ec, std::errc{});
+    EXPECT_EQ(std::string_view(buffer, zero.ptr), "0");
+
+    EXPECT_EQ(big_int().to_chars(buffer, buffer).ec, std::errc::value_too_large);
+    EXPECT_EQ(big_int(1).to_chars(buffer, buffer + sizeof buffer, 37).ec, std::errc::invalid_argument);
+    EXPECT_EQ(big_int(1).max_chars(1), 0U);
+}
+
+TEST_F(BigIntCharsTest, ExactBufferFitsAndOneShortDoesNot) {
+    // below and above the divide-and-conquer threshold, in power-of-two and other bases
+    std::uint64_t seed = 1600;
+    for (const int base : {2, 10, 16, 36}) {
+        for (const size_t limbs : {1, 3, 19, 40, 300}) {
+            const big_int     a        = -helpers::random_big_int(limbs, seed++);
+            const std::string expected = a.to_string(base);
+
+            ASSERT_GE(a.max_chars(base), expected.size());
+            EXPECT_LE(a.max_chars(base), expected.size() + 1);
+
+            std::errc ec{};
+            EXPECT_EQ(to_chars_sized(a, expected.size(), base, ec), expected) << "base " << base;
+            EXPECT_EQ(ec, std::errc{});
+            EXPECT_EQ(to_chars_sized(a, a.max_chars(base) + 1000, base, ec), expected) << "base " << base;
+
+            to_chars_sized(a, expected.size() - 1, base, ec);
+            EXPECT_EQ(ec, std::errc::value_too_large) << "base " << base << ", " << limbs << " limbs";
+        }
+    }
+}
+
+TEST_F(BigIntCharsTest, FromCharsStopsAtTheFirstNonDigit) {
+    big_int           value;
+    const std::string input = "-12345xyz";
+
+    const auto result = big_int::from_chars(input.data(), input.data() + input.size(), value);
+    EXPECT_EQ(result.ec, std::errc{});
+    EXPECT_EQ(result.ptr, input.data() + 6);
+    EXPECT_BI_EQ(value, -12345);
+
+    const std::string hex = "7fFfz";
+    const auto        hex_result = big_int::from_chars(hex.data(), hex.data() + hex.size(), value, 16);
+    EXPECT_EQ(hex_result.ptr, hex.data() + 4);
+    EXPECT_BI_EQ(value, 0x7fff);
+}
+
+TEST_F(BigIntCharsTest, FromCharsRejectsMissingDigits) {
+    for (const std::string_view input : {"", "-", "+1", " 1", "x1", "-g"}) {
+        big_int    value  = 42;
+        const auto result = big_int::from_chars(input.data(), input.data() + input.size(), value, 16);
+        EXPECT_EQ(result.ec, std::errc::invalid_argument) << input;
+        EXPECT_EQ(result.ptr, input.data()) << input;
+        EXPECT_BI_EQ(value, 42);
+    }
+
+    big_int          value  = 42;
+    std::string_view digits = "123";
+    EXPECT_EQ(big_int::from_chars(digits.data(), digits.data() + 3, value, 1).ec, std::errc::invalid_argument);
+    EXPECT_BI_EQ(value, 42);
+}
+
+TEST_F(BigIntCharsTest, RoundTripsThroughChars) {
+    std::uint64_t seed = 1700;
+    for (const int base : {3, 8, 10, 32}) {
+        for (const size_t limbs : {1, 7, 25, 500}) {
+            const big_int     a = helpers::random_big_int(limbs, seed++);
+            std::vector<char> buffer(a.max_chars(base));
+            const auto        written = a.to_chars(buffer.data(), buffer.data() + buffer.size(), base);
+            ASSERT_EQ(written.ec, std::errc{});
+
+            big_int    parsed;
+            const auto read = big_int::from_chars(buffer.data(), written.ptr, parsed, base);
+            EXPECT_EQ(read.ec, std::errc{});
+            EXPECT_EQ(read.ptr, written.ptr);
+            EXPECT_BI_EQ(parsed, a);
+        }
+    }
+}
+
+TEST_F(BigIntCharsTest, FormatterMatchesToString) {
+    // short values go through the stack buffer, long ones through to_string
+    for (const size_t limbs : {1, 10, 40, 200}) {
+        const big_int a = -helpers::random_big_int(limbs, 1800 + limbs);
+        EXPECT_EQ(std::format("{}", a), a.to_string());
+        EXPECT_EQ(std::format("[{}]", a), "[" + a.to_string() + "]");
+    }
+}
+
+} // namespace arbys::bignum::tests
@@ -1,8 +1,14 @@
 #include <gtest/gtest.h>
 
 #include "../../include/arbys/bignum/big_int.h"
+#include "../../include/arbys/bignum/errors.h"
+#include "../../src/arbys/bignum/detail/big_int_internal.h"
+#include "../../src/arbys/bignum/detail/detail.h"
 #include "../helpers/helpers.h"
 
+#include <cstdint>
+#include <stdexcept>
+
 namespace arbys::bignum::tests {
 
 TEST(BigIntDivWithLongLongTest, SimpleLongLongDivision) {
@@ -111,4 +117,296 @@ TEST(BigIntDivTest, MultipleDivisions) {
 
 }
 
+// q * b + r == a with |r| < |b| and r carrying the sign of a, which pins down truncating division
+static void expect_division_identity(const big_int &a, const big_int &b, const big_int &q, const big_int &r) {
+    EXPECT_BI_EQ(q * b + r, a);
+    EXPECT_LT(r.abs(), b.abs());
+    EXPECT_TRUE(r.is_zero() || r.is_negative() == a.is_negative());
+}
+
+TEST(BigIntDivTest, DivisionIdentityHolds) {
+    std::uint64_t seed = 60;
+    for (const size_t divisor_size : {1, 2, 3, 8, 40}) {
+        for (const size_t extra : {0, 1, 5, 60}) {
+            const big_int a = helpers::random_big_int(divisor_size + extra, seed++);
+            const big_int b = helpers::random_big_int(divisor_size, seed++);
+            const auto    result = a.div_mod(b);
+            ASSERT_TRUE(result.has_value());
+            expect_division_identity(a, b, result->first, result->second);
+        }
+    }
+}
+
+static big_int power_of_two(const unsigned bits) {
+    big_int result = 1;
+    for (unsigned i = 0; i < bits; ++i) {
+        result *= 2;
+    }
+    return result;
+}
+
+TEST(BigIntDivTest, QuotientEstimateAtItsCap) {
+    // divisors with all-ones top limbs and dividends whose top limbs equal the divisor's push the trial
+    // quotient digit to B - 1 and through the add-back step
+    const big_int ones = power_of_two(200) - 1;
+    for (const big_int &b : {power_of_two(140) - 1, (power_of_two(100) - 1) * power_of_two(40), power_of_two(127) + 1,
+                             power_of_two(64)}) {
+        for (const big_int &a : {ones, ones - b / 8, b * b - 1, b * (power_of_two(70) - 1)}) {
+            const auto result = a.div_mod(b);
+            ASSERT_TRUE(result.has_value());
+            expect_division_identity(a, b, result->first, result->second);
+        }
+    }
+}
+
+TEST(BigIntDivTest, RecursiveMatchesBasecase) {
+    // around the threshold, odd sizes that need padding, and divisors that are already normalized
+    std::uint64_t seed = 80;
+    for (const size_t divisor_size : {detail::burnikel_ziegler_threshold, size_t{97}, size_t{130}, size_t{257}}) {
+        for (const size_t dividend_size : {2 * divisor_size, 2 * divisor_size + 1, 5 * divisor_size + 3}) {
+            const big_int a = helpers::random_big_int(dividend_size, seed++);
+            const big_int b = helpers::random_big_int(divisor_size, seed++);
+
+            const auto recursive = detail::div_mod_recursive(a, b);
+            const auto basecase  = detail::div_mod_basecase(a, b);
+            EXPECT_BI_EQ(recursive.quotient, basecase.quotient) << divisor_size << " into " << dividend_size;
+            EXPECT_BI_EQ(recursive.remainder, basecase.remainder) << divisor_size << " into " << dividend_size;
+        }
+    }
+
+    const big_int ones = power_of_two(64 * 300) - 1;
+    const big_int top  = power_of_two(64 * 120) - 1;
+    const auto    edge = detail::div_mod_recursive(ones, top);
+    expect_division_identity(ones, top, edge.quotient, edge.remainder);
+}
+
+TEST(BigIntDivTest, LargeDivisionIdentityHolds) {
+    std::uint64_t seed = 90;
+    for (const size_t divisor_size : {size_t{200}, size_t{1000}}) {
+        const big_int a = helpers::random_big_int(3 * divisor_size + 17, seed++);
+        const big_int b = -helpers::random_big_int(divisor_size, seed++);
+        const auto    result = a.div_mod(b);
+        ASSERT_TRUE(result.has_value());
+        expect_division_identity(a, b, result->first, result->second);
+
+        const big_int::divisor d(b);
+        EXPECT_BI_EQ(a / d, result->first);
+        EXPECT_BI_EQ(a % d, result->second);
+    }
+}
+
+TEST(BigIntDivTest, AlgorithmsAgree) {
+    using detail::division_algorithm;
+    std::uint64_t seed = 100;
+    for (const size_t divisor_size : {size_t{1}, size_t{3}, size_t{60}, size_t{150}}) {
+        for (const size_t dividend_size : {divisor_size, 2 * divisor_size, 5 * divisor_size + 1}) {
+            const big_int a        = helpers::random_big_int(dividend_size, seed++);
+            const big_int b        = helpers::random_big_int(divisor_size, seed++);
+            const auto    expected = detail::div_mod_abs(a, b, division_algorithm::schoolbook).value();
+            for (const auto algorithm : {division_algorithm::automatic, division_algorithm::recursive, division_algorithm::newton}) {
+                const auto result = detail::div_mod_abs(a, b, algorithm).value();
+                EXPECT_BI_EQ(result.quotient, expected.quotient) << divisor_size << " into " << dividend_size;
+                EXPECT_BI_EQ(result.remainder, expected.remainder) << divisor_size << " into " << dividend_size;
+            }
+        }
+    }
+}
+
+TEST(BigIntDivTest, QuotientAndRemainderAloneMatchDivMod) {
+    std::uint64_t seed = 160;
+    for (const size_t divisor_size : {size_t{1}, size_t{2}, size_t{60}}) {
+        for (const size_t dividend_size : {divisor_size / 2, divisor_size, 3 * divisor_size + 50}) {
+            const big_int a        = helpers::random_big_int(dividend_size, seed++);
+            const big_int b        = helpers::random_big_int(divisor_size, seed++);
+            const auto    expected = a.div_mod(b).value();
+            EXPECT_BI_EQ(a / b, expected.first) << divisor_size << " into " << dividend_size;
+            EXPECT_BI_EQ(a % b, expected.second) << divisor_size << " into " << dividend_size;
+            EXPECT_BI_EQ((-a) % b, -expected.second) << divisor_size << " into " << dividend_size;
+            EXPECT_BI_EQ(a % -b, expected.second) << divisor_size << " into " << dividend_size;
+        }
+    }
+    EXPECT_EQ(big_int(42).mod(big_int()).error(), errors::ArithmeticError::DivisionByZero);
+}
+
+TEST(BigIntDivTest, ModLimbMatchesDivmodLimb) {
+    using detail::limb_t;
+    constexpr limb_t top   = limb_t{1} << (detail::LIMB_BITS - 1);
+    const big_int    x     = helpers::random_big_int(30, 170);
+    const auto       limbs = detail::big_int_access::limb_span(x);
+
+    // divisors with the top bit set fold without a shift; the rest shift each limb in as it is read
+    for (const limb_t d : {~limb_t{0}, top, top | 12345, limb_t{1}, limb_t{3}, limb_t{10}, top - 1}) {
+        const auto prepared = detail::prepare_limb_divisor(d);
+        for (const size_t size : {size_t{0}, size_t{1}, size_t{2}, limbs.size()}) {
+            const auto          input = limbs.first(size);
+            detail::limb_vector quotient(size);
+            const limb_t        expected = detail::divmod_limb(quotient, input, d);
+            EXPECT_EQ(detail::mod_limb(input, d), expected) << d << " into " << size;
+            EXPECT_EQ(detail::mod_limb(input, prepared), expected) << d << " into " << size;
+        }
+        const big_int divisor = detail::big_int_access::create(false, {d});
+        EXPECT_BI_EQ(x % divisor, x.div_mod(divisor).value().second) << d;
+    }
+}
+
+TEST(BigIntDivTest, KnuthHalvesWithAddBack) {
+    // both overestimate a quotient limb past the two-limb correction, so Knuth's D6 adds the divisor back
+    const unsigned bits = detail::LIMB_BITS;
+    const std::pair<big_int, big_int> cases[] = {
+      {power_of_two(3 * bits), power_of_two(2 * bits) + 1},
+      {power_of_two(5 * bits) - power_of_two(3 * bits), power_of_two(3 * bits - 1) - 1},
+    };
+    for (const auto &[a, b] : cases) {
+        const auto expected = detail::div_mod_abs(a, b, detail::division_algorithm::schoolbook).value();
+        expect_division_identity(a, b, expected.quotient, expected.remainder);
+        EXPECT_BI_EQ(detail::div_abs(a, b).value(), expected.quotient);
+        EXPECT_BI_EQ(detail::mod_abs(a, b).value(), expected.remainder);
+    }
+    EXPECT_BI_EQ(detail::div_abs(cases[0].first, cases[0].second).value(), power_of_two(bits) - 1);
+}
+
+TEST(BigIntDivTest, RecursiveHalvesMatchDivMod) {
+    std::uint64_t seed = 180;
+    for (const size_t divisor_size : {size_t{48}, size_t{60}, size_t{101}}) {
+        const big_int b = helpers::random_big_int(divisor_size, seed++);
+        const big_int q = helpers::random_big_int(divisor_size + 60, seed++);
+        for (const big_int &a : {q * b, q * b + (b - 1), helpers::random_big_int(3 * divisor_size, seed++)}) {
+            const auto expected = detail::div_mod_abs(a, b, detail::division_algorithm::recursive).value();
+            EXPECT_BI_EQ(detail::div_abs(a, b).value(), expected.quotient) << divisor_size;
+            EXPECT_BI_EQ(detail::mod_abs(a, b).value(), expected.remainder) << divisor_size;
+        }
+    }
+}
+
+TEST(BigIntDivExactTest, MatchesDiv) {
+    std::uint64_t seed = 140;
+    for (const size_t divisor_size : {size_t{1}, size_t{2}, size_t{50}, size_t{300}}) {
+        // 800 by 300 limbs is past the Hensel loop's crossover to the recursive division
+        for (const size_t quotient_size : {size_t{1}, size_t{3}, size_t{60}, size_t{300}, size_t{800}}) {
+            const big_int q = helpers::random_big_int(quotient_size, seed++);
+            const big_int d = helpers::random_big_int(divisor_size, seed++);
+            // even divisors take the shift, including ones with whole zero limbs at the bottom
+            for (const big_int &divisor : {d, d * 6, d * power_of_two(70)}) {
+                const big_int x = q * divisor;
+                EXPECT_BI_EQ(x.divexact(divisor).value(), x / divisor) << quotient_size << " by " << divisor_size;
+                EXPECT_BI_EQ((-x).divexact(divisor).value(), -(x / divisor)) << quotient_size << " by " << divisor_size;
+                EXPECT_BI_EQ(x.divexact(-divisor).value(), -(x / divisor)) << quotient_size << " by " << divisor_size;
+            }
+        }
+    }
+}
+
+TEST(BigIntDivExactTest, EdgeCases) {
+    EXPECT_BI_EQ(big_int().divexact(big_int(7)).value(), big_int());
+    EXPECT_BI_EQ(big_int(42).divexact(big_int(42)).value(), big_int(1));
+    EXPECT_BI_EQ(big_int(-42).divexact(big_int(-6)).value(), big_int(7));
+    EXPECT_BI_EQ(power_of_two(300).divexact(power_of_two(299)).value(), big_int(2));
+    EXPECT_BI_EQ((power_of_two(200) * 3).divexact(big_int(12)).value(), power_of_two(198));
+    const big_int ones = power_of_two(64 * 20) - 1;
+    EXPECT_BI_EQ((ones * ones).divexact(ones).value(), ones);
+    EXPECT_EQ(big_int(42).divexact(big_int()).error(), errors::ArithmeticError::DivisionByZero);
+}
+
+TEST(BigIntDivExactTest, LimbKernel) {
+    // the kernel divides in place, as Toom-Cook interpolation uses it
+    const big_int     x     = helpers::random_big_int(40, 150) * 12;
+    detail::limb_vector limbs = detail::big_int_access::limbs(x);
+    EXPECT_EQ(detail::divexact_limb(limbs, limbs, 12), 0u);
+    EXPECT_BI_EQ(detail::big_int_access::create(false, std::move(limbs)), x / 12);
+}
+
+TEST(BigIntReciprocalTest, TruncatedPowerOfTwoOverValue) {
+    std::uint64_t seed = 110;
+    for (const size_t size : {size_t{1}, size_t{4}, size_t{90}}) {
+        const big_int x = helpers::random_big_int(size, seed++);
+        for (const size_t precision : {size_t{0}, size_t{17}, 32 * size, 64 * size + 5, 200 * size}) {
+            const big_int expected = power_of_two(static_cast<unsigned>(precision)) / x;
+            EXPECT_BI_EQ(x.reciprocal(precision).value(), expected) << size << " limbs, " << precision << " bits";
+            EXPECT_BI_EQ((-x).reciprocal(precision).value(), -expected) << size << " limbs, " << precision << " bits";
+        }
+    }
+    EXPECT_BI_EQ(big_int(3).reciprocal(10).value(), big_int(341));
+    EXPECT_EQ(big_int().reciprocal(10).error(), errors::ArithmeticError::DivisionByZero);
+}
+
+TEST(BarrettReducerTest, MatchesDivMod) {
+    std::uint64_t seed = 120;
+    for (const size_t modulus_size : {size_t{1}, size_t{2}, size_t{40}, size_t{130}}) {
+        const big_int         m = helpers::random_big_int(modulus_size, seed++);
+        const barrett_reducer reducer(m);
+        const barrett_reducer negative(-m);
+        EXPECT_BI_EQ(reducer.modulus(), m);
+
+        for (const size_t size : {size_t{1}, modulus_size, 2 * modulus_size, 7 * modulus_size + 3}) {
+            const big_int x        = helpers::random_big_int(size, seed++);
+            const auto    expected = x.div_mod(m).value();
+            EXPECT_BI_EQ(reducer.reduce(x), expected.second);
+            EXPECT_BI_EQ(reducer.reduce(-x), -expected.second);
+
+            const auto [q, r] = negative.div_mod(x);
+            EXPECT_BI_EQ(q, -expected.first);
+            EXPECT_BI_EQ(r, expected.second);
+        }
+
+        const big_int a = helpers::random_big_int(modulus_size, seed++) % m;
+        const big_int b = helpers::random_big_int(modulus_size, seed++) % m;
+        EXPECT_BI_EQ(reducer.mul_mod(a, b), a * b % m);
+    }
+
+    EXPECT_THROW(barrett_reducer{big_int()}, std::domain_error);
+}
+
+TEST(BarrettReducerTest, RemainderKernelsMatchDivMod) {
+    // the reducer only takes these kernels past barrett_threshold, so short moduli are checked here
+    std::uint64_t seed = 190;
+    for (const size_t modulus_size : {size_t{1}, size_t{2}, size_t{7}, size_t{60}}) {
+        const big_int m            = helpers::random_big_int(modulus_size, seed++);
+        const big_int reciprocal   = detail::reciprocal_abs(m);
+        const big_int below_square = m * m - 1;
+        for (const big_int &x : {big_int(), m - 1, m, below_square, helpers::random_big_int(5 * modulus_size + 1, seed++)}) {
+            const auto expected = x.div_mod(m).value();
+            EXPECT_BI_EQ(detail::mod_newton(x, m, reciprocal), expected.second) << modulus_size;
+            EXPECT_BI_EQ(detail::div_mod_newton(x, m, reciprocal).remainder, expected.second) << modulus_size;
+        }
+    }
+}
+
+TEST(BigIntDivisorTest, MatchesDivMod) {
+    std::uint64_t seed = 70;
+    // 101 limbs pad to a 104-limb block, which the recursive division takes from the divisor object
+    for (const size_t divisor_size : {1, 2, 5, 30, 101}) {
+        const big_int         b = helpers::random_big_int(divisor_size, seed++);
+        const big_int::divisor d(b);
+        const big_int::divisor negative(-b);
+        for (const size_t dividend_size : {size_t{1}, divisor_size, divisor_size + 1, 3 * divisor_size + 7}) {
+            const big_int a        = helpers::random_big_int(dividend_size, seed++);
+            const auto    expected = a.div_mod(b).value();
+            EXPECT_BI_EQ(d.div(a), expected.first);
+            EXPECT_BI_EQ(d.mod(a), expected.second);
+            EXPECT_BI_EQ(a / d, expected.first);
+            EXPECT_BI_EQ(a % d, expected.second);
+
+            const auto [q, r] = negative.div_mod(-a);
+            EXPECT_BI_EQ(q, expected.first);
+            EXPECT_BI_EQ(r, -expected.second);
+            EXPECT_BI_EQ(-a / d, -expected.first);
+        }
+    }
+}
+
+TEST(BigIntDivisorTest, SmallDivisorsAndEdgeCases) {
+    const big_int a = big_int::from_string("40000490494094049049049409").value();
+    for (const long long small : {1LL, 3LL, 7LL, 10LL, 1LL << 31, (1LL << 32) - 1, 1'000'000'007LL}) {
+        const big_int::divisor d{big_int(small)};
+        EXPECT_BI_EQ(a / d, a / small);
+        EXPECT_BI_EQ(a % d, a % small);
+    }
+
+    const big_int::divisor d{big_int(7)};
+    EXPECT_BI_EQ(big_int() / d, big_int());
+    EXPECT_BI_EQ(big_int(6) % d, big_int(6));
+    EXPECT_BI_EQ(d.value(), big_int(7));
+    EXPECT_THROW(big_int::divisor{big_int()}, std::domain_error);
+}
+
 } // namespace arbys::bignum::tests
\ No newline at end of file
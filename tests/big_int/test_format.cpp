@@ -0,0 +1,136 @@
+#include "arbys/bignum/big_int.h"
+#include "arbys/bignum/format.h"
+
+#include "../helpers/helpers.h"
+
+#include <gtest/gtest.h>
+
+#include <format>
+#include <string>
+#include <string_view>
+
+namespace arbys::bignum::tests {
+
+class BigIntFormatTest : public ::testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static std::string vformat(const std::string_view spec, const big_int &value) {
+        return std::vformat(spec, std::make_format_args(value));
+    }
+
+    // Reference grouping: sep between every `group` characters of digits, counted from the right
+    static std::string group_digits(const std::string &digits, const size_t group, const char sep) {
+        std::string out;
+        for (size_t i = 0; i < digits.size(); ++i) {
+            if (i != 0 && (digits.size() - i) % group == 0) {
+                out.push_back(sep);
+            }
+            out.push_back(digits[i]);
+        }
+        return out;
+    }
+};
+
+TEST_F(BigIntFormatTest, DefaultMatchesToString) {
+    const big_int a = big_int::from_string("-123456789012345678901234567890").value();
+    EXPECT_EQ(std::format("{}", a), a.to_string());
+    EXPECT_EQ(std::format("{:d}", a), a.to_string());
+    EXPECT_EQ(std::format("{}", big_int()), "0");
+}
+
+TEST_F(BigIntFormatTest, Bases) {
+    const big_int a = 255;
+    EXPECT_EQ(std::format("{:b}", a), "11111111");
+    EXPECT_EQ(std::format("{:o}", a), "377");
+    EXPECT_EQ(std::format("{:x}", a), "ff");
+    EXPECT_EQ(std::format("{:X}", a), "FF");
+    EXPECT_EQ(std::format("{:x}", -a), "-ff");
+}
+
+TEST_F(BigIntFormatTest, AlternateForm) {
+    const big_int a = 255;
+    EXPECT_EQ(std::format("{:#b}", a), "0b11111111");
+    EXPECT_EQ(std::format("{:#B}", a), "0B11111111");
+    EXPECT_EQ(std::format("{:#o}", a), "0377");
+    EXPECT_EQ(std::format("{:#x}", -a), "-0xff");
+    EXPECT_EQ(std::format("{:#X}", a), "0XFF");
+    EXPECT_EQ(std::format("{:#d}", a), "255");
+
+    // octal zero gets no extra 0, the other prefixes stay
+    EXPECT_EQ(std::format("{:#o}", big_int()), "0");
+    EXPECT_EQ(std::format("{:#x}", big_int()), "0x0");
+}
+
+TEST_F(BigIntFormatTest, Sign) {
+    EXPECT_EQ(std::format("{:+}", big_int(5)), "+5");
+    EXPECT_EQ(std::format("{:+}", big_int(-5)), "-5");
+    EXPECT_EQ(std::format("{: }", big_int(5)), " 5");
+    EXPECT_EQ(std::format("{: }", big_int(-5)), "-5");
+    EXPECT_EQ(std::format("{:-}", big_int(5)), "5");
+    EXPECT_EQ(std::format("{:+#x}", big_int(26)), "+0x1a");
+}
+
+TEST_F(BigIntFormatTest, WidthFillAndAlign) {
+    const big_int a = 42;
+    EXPECT_EQ(std::format("{:6}", a), "    42");
+    EXPECT_EQ(std::format("{:<6}|", a), "42    |");
+    EXPECT_EQ(std::format("{:>6}", a), "    42");
+    EXPECT_EQ(std::format("{:^7}", a), "  42   ");
+    EXPECT_EQ(std::format("{:*^7}", -a), "**-42**");
+    EXPECT_EQ(std::format("{:1}", a), "42");
+    EXPECT_EQ(std::format("{:é>5}", a), "ééé42");
+}
+
+TEST_F(BigIntFormatTest, ZeroPadding) {
+    EXPECT_EQ(std::format("{:08}", big_int(-42)), "-0000042");
+    EXPECT_EQ(std::format("{:#010x}", big_int(255)), "0x000000ff");
+    EXPECT_EQ(std::format("{:+06}", big_int(7)), "+00007");
+
+    // an explicit alignment wins over the zero flag
+    EXPECT_EQ(std::format("{:<06}|", big_int(7)), "7     |");
+}
+
+TEST_F(BigIntFormatTest, DynamicWidth) {
+    const big_int a = 42;
+    EXPECT_EQ(std::format("{:{}}", a, 5), "   42");
+    EXPECT_EQ(std::format("{0:*<{1}}", a, 4u), "42**");
+    EXPECT_THROW((void)std::vformat("{:{}}", std::make_format_args(a, "x")), std::format_error);
+}
+
+TEST_F(BigIntFormatTest, Grouping) {
+    EXPECT_EQ(std::format("{:,}", big_int(1234567)), "1,234,567");
+    EXPECT_EQ(std::format("{:,}", big_int(-123456)), "-123,456");
+    EXPECT_EQ(std::format("{:_}", big_int(1000)), "1_000");
+    EXPECT_EQ(std::format("{:,}", big_int(999)), "999");
+    EXPECT_EQ(std::format("{:,}", big_int()), "0");
+    EXPECT_EQ(std::format("{:_x}", big_int(0xdeadbeefLL)), "dead_beef");
+    EXPECT_EQ(std::format("{:#_b}", big_int(37)), "0b10_0101");
+    EXPECT_EQ(std::format("{:>12,}", big_int(1234567)), "   1,234,567");
+}
+
+TEST_F(BigIntFormatTest, LongValues) {
+    // stack buffer and, for the binary form of 2000 limbs, the heap fallback
+    std::uint64_t seed = 1900;
+    for (const size_t limbs : {30, 300, 2000}) {
+        const big_int     a       = -helpers::random_big_int(limbs, seed++);
+        const std::string decimal = a.abs().to_string();
+
+        EXPECT_EQ(std::format("{:,}", a), "-" + group_digits(decimal, 3, ','));
+        EXPECT_EQ(std::format("{:#x}", a), "-0x" + a.abs().to_string(16));
+        EXPECT_EQ(std::format("{:b}", a), a.to_string(2));
+
+        const std::string padded = std::format("{:*>{}}", a, decimal.size() + 11);
+        EXPECT_EQ(padded, std::string(10, '*') + "-" + decimal);
+    }
+}
+
+TEST_F(BigIntFormatTest, RejectsInvalidSpecs) {
+    const big_int a = 1;
+    for (const std::string_view spec : {"{:.3}", "{:L}", "{:,x}", "{:q}", "{:{<5}", "{:5,d,}"}) {
+        EXPECT_THROW((void)vformat(spec, a), std::format_error) << spec;
+    }
+}
+
+} // namespace arbys::bignum::tests
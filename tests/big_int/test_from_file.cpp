@@ -0,0 +1,113 @@
+#include "arbys/bignum/big_int.h"
+#include "arbys/bignum/errors.h"
+
+#include "../../src/arbys/bignum/detail/detail.h"
+#include "../helpers/helpers.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+namespace arbys::bignum::tests {
+
+class BigIntFromFileTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        path_ = std::filesystem::temp_directory_path() /
+                ("arbys_bignum_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) + ".txt");
+    }
+    void TearDown() override { std::filesystem::remove(path_); }
+
+    const std::filesystem::path &write(const std::string_view contents) {
+        std::ofstream(path_, std::ios::binary) << contents;
+        return path_;
+    }
+
+    std::filesystem::path path_;
+};
+
+// digits with sep inserted every `group` digits from the left
+static std::string grouped(const std::string &digits, const std::string_view sep, const size_t group) {
+    std::string result;
+    for (size_t i = 0; i < digits.size(); ++i) {
+        if (i > 0 && i % group == 0) {
+            result += sep;
+        }
+        result += digits[i];
+    }
+    return result;
+}
+
+TEST_F(BigIntFromFileTest, SmallBlocksMatchFromString) {
+    // a block level of 0 makes every limb-sized chunk its own block, exercising the tree on short inputs
+    for (const size_t size : {1, 2, 3, 17, 64, 257}) {
+        const std::string digits = helpers::random_big_int(size, 50 + size).to_string();
+        for (const size_t level : {0, 1, 3}) {
+            for (const unsigned threads : {1u, 3u, 8u}) {
+                const auto parsed = detail::parse_decimal_parallel(digits, true, {}, threads, level);
+                ASSERT_TRUE(parsed.has_value());
+                EXPECT_BI_EQ(*parsed, -*big_int::from_string(digits)) << "size " << size << " level " << level;
+            }
+        }
+    }
+}
+
+TEST_F(BigIntFromFileTest, SeparatorsAcrossBlockBoundaries) {
+    const std::string digits = helpers::random_big_int(200, 51).to_string();
+    const big_int     expected = *big_int::from_string(digits);
+
+    for (const std::string_view sep : {"_", ", ", "::"}) {
+        for (const size_t group : {1, 3, 7}) {
+            const std::string text = grouped(digits, sep, group);
+            EXPECT_BI_EQ(*big_int::from_string(text, sep), expected);
+            for (const size_t level : {0, 2}) {
+                const auto parsed = detail::parse_decimal_parallel(text, false, sep, 4, level);
+                ASSERT_TRUE(parsed.has_value()) << sep << " every " << group;
+                EXPECT_BI_EQ(*parsed, expected) << sep << " every " << group << " level " << level;
+            }
+        }
+    }
+}
+
+TEST_F(BigIntFromFileTest, ValidatesInParallel) {
+    // long enough to be split into several ranges for validation
+    const std::string digits = std::string(300'000, '7');
+    std::string       text   = grouped(digits, "_", 5);
+    EXPECT_BI_EQ(*detail::parse_decimal_parallel(text, false, "_", 8, 2), *big_int::from_string(digits));
+
+    text[text.size() / 3] = 'x';
+    EXPECT_EQ(detail::parse_decimal_parallel(text, false, "_", 8, 2).error(), errors::ParseError::InvalidCharacter);
+}
+
+TEST_F(BigIntFromFileTest, SeparatorContainingDigits) {
+    // "0," can only be found by scanning from the front, so validation is not split
+    const std::string text = "10,20,30,";
+    EXPECT_BI_EQ(*big_int::from_string(text, "0,"), big_int(123));
+    EXPECT_BI_EQ(*detail::parse_decimal_parallel(text, false, "0,", 4, 0), big_int(123));
+}
+
+TEST_F(BigIntFromFileTest, ParsesFiles) {
+    const big_int value = -helpers::random_big_int(500, 52);
+    EXPECT_BI_EQ(*big_int::from_file(write("  " + value.to_string() + "\n")), value);
+    EXPECT_BI_EQ(*big_int::from_file(write(grouped(value.abs().to_string(), "_", 3)), "_", 2), value.abs());
+    EXPECT_BI_EQ(*big_int::from_file(write("+42\n")), big_int(42));
+    EXPECT_BI_EQ(*big_int::from_file(write("-0")), big_int(0));
+    EXPECT_FALSE(big_int::from_file(write("-0")).value().is_negative());
+}
+
+TEST_F(BigIntFromFileTest, Errors) {
+    EXPECT_EQ(big_int::from_file(path_.string() + ".missing").error(), errors::ParseError::UnreadableFile);
+    EXPECT_EQ(big_int::from_file(std::filesystem::temp_directory_path()).error(), errors::ParseError::UnreadableFile);
+    EXPECT_EQ(big_int::from_file(write("")).error(), errors::ParseError::EmptyInput);
+    EXPECT_EQ(big_int::from_file(write(" \n\t")).error(), errors::ParseError::EmptyInput);
+    EXPECT_EQ(big_int::from_file(write("-")).error(), errors::ParseError::NoDigits);
+    EXPECT_EQ(big_int::from_file(write("__"), "_").error(), errors::ParseError::NoDigits);
+    EXPECT_EQ(big_int::from_file(write("12a4")).error(), errors::ParseError::InvalidCharacter);
+    EXPECT_EQ(big_int::from_file(write("12 34")).error(), errors::ParseError::InvalidCharacter);
+    EXPECT_EQ(big_int::from_file(write("1_2-4"), "_").error(), errors::ParseError::InvalidCharacter);
+}
+
+} // namespace arbys::bignum::tests
@@ -43,4 +43,10 @@ TEST(FromIntegerTest, FromNegativeLongLong) {
     const big_int       bi = big_int::from_integer(nr);
     EXPECT_BI_EQ(bi, std::to_string(nr));
 }
+
+TEST(FromIntegerTest, FromUnsignedLongLongMax) {
+    constexpr unsigned long long nr = std::numeric_limits<unsigned long long>::max();
+    const big_int                bi = big_int::from_integer(nr);
+    EXPECT_BI_EQ(bi, std::to_string(nr));
+}
 } // namespace arbys::bignumbers::tests
@@ -1,8 +1,14 @@
 #include <gtest/gtest.h>
 
 #include "../../include/arbys/bignum/big_int.h"
+#include "../../src/arbys/bignum/detail/detail.h"
 #include "../helpers/helpers.h"
 
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
 namespace arbys::bignum::tests {
 
 TEST(BigIntFromString, NoSeparatorDigitsOnly) {
@@ -84,4 +90,92 @@ TEST(BigIntFromString, ZeroValueAlwaysPositive) {
     }
 }
 
+TEST(BigIntFromString, LongPowersOfTen) {
+    // lengths around the chunk size, the divide-and-conquer threshold and its split points
+    big_int power = 1;
+    size_t  k     = 0;
+    for (const size_t target : {8, 9, 10, 18, 19, 20, 1199, 1200, 1201, 2433, 5000}) {
+        for (; k < target; ++k) {
+            power *= 10;
+        }
+        EXPECT_BI_EQ(big_int::from_string("1" + std::string(k, '0')).value(), power) << "10^" << k;
+        EXPECT_BI_EQ(big_int::from_string("-" + std::string(k, '9')).value(), 1 - power) << "-(10^" << k << " - 1)";
+    }
+}
+
+TEST(BigIntFromString, LongInputMatchesChunkedParser) {
+    std::mt19937_64 rng(1300);
+    for (const size_t digits : {1000, 1300, 3000, 9001, 20000}) {
+        std::string s(digits, '0');
+        for (char &c : s) {
+            c = static_cast<char>('0' + rng() % 10);
+        }
+        s.replace(0, 5, "00042");
+
+        const auto tiered  = big_int::from_string(s);
+        const auto chunked = detail::parse_limbs_optimized(s, false);
+        ASSERT_TRUE(tiered.has_value() && chunked.has_value());
+        EXPECT_BI_EQ(tiered.value(), chunked.value());
+        EXPECT_EQ(tiered->to_string(), s.substr(3));
+    }
+}
+
+TEST(BigIntFromString, LongInputRejectsInvalidCharacter) {
+    std::string s(5000, '7');
+    s[4321] = 'x';
+    helpers::expect_err(big_int::from_string(s), errors::ParseError::InvalidCharacter);
+}
+
+TEST(BigIntFromString, DigitKernelsMatchScalar) {
+    std::mt19937_64 rng(1310);
+    for (const auto kernel : {detail::digit_kernel::scalar, detail::digit_kernel::sse41, detail::digit_kernel::avx2}) {
+        if (!detail::digit_kernel_supported(kernel)) {
+            continue;
+        }
+        // odd and even block counts, so the AVX2 kernel also hands a single block to the SSE one
+        for (const size_t blocks : {1, 2, 3, 8, 67}) {
+            std::string digits(16 * blocks, '0');
+            for (char &c : digits) {
+                c = static_cast<char>('0' + rng() % 10);
+            }
+            digits.replace(0, 16, "9999999999999999");
+
+            std::vector<std::uint64_t> values(blocks);
+            ASSERT_TRUE(detail::parse_digit_blocks(kernel, digits, values));
+            for (size_t i = 0; i < blocks; ++i) {
+                EXPECT_EQ(values[i], std::stoull(digits.substr(16 * i, 16))) << "kernel " << static_cast<int>(kernel);
+            }
+        }
+    }
+}
+
+TEST(BigIntFromString, DigitKernelsRejectEveryPosition) {
+    // bytes just outside '0'..'9', and ones that only differ from a digit in the high bit
+    const std::string bad = {'/', ':', ' ', '\0', 'a', static_cast<char>(0xB0), static_cast<char>(0xB9), static_cast<char>(0xFF)};
+
+    for (const auto kernel : {detail::digit_kernel::scalar, detail::digit_kernel::sse41, detail::digit_kernel::avx2}) {
+        if (!detail::digit_kernel_supported(kernel)) {
+            continue;
+        }
+        std::vector<std::uint64_t> values(3);
+        for (size_t pos = 0; pos < 48; ++pos) {
+            for (const char c : bad) {
+                std::string digits(48, '5');
+                digits[pos] = c;
+                EXPECT_FALSE(detail::parse_digit_blocks(kernel, digits, values))
+                  << "kernel " << static_cast<int>(kernel) << ", byte " << static_cast<int>(c) << " at " << pos;
+            }
+        }
+    }
+}
+
+TEST(BigIntFromString, RejectsInvalidCharacterAnywhere) {
+    // covers the leading partial block and the full ones after it
+    for (size_t pos = 1; pos < 70; ++pos) {
+        std::string s(70, '3');
+        s[pos] = ':';
+        helpers::expect_err(big_int::from_string(s), errors::ParseError::InvalidCharacter);
+    }
+}
+
 } // namespace arbys::bignumbers::tests
@@ -1,9 +1,14 @@
 #include "arbys/bignum/big_int.h"
 
+#include "../../src/arbys/bignum/detail/big_int_internal.h"
+#include "../../src/arbys/bignum/detail/detail.h"
 #include "../helpers/helpers.h"
 
 #include <gtest/gtest.h>
 
+#include <limits>
+#include <utility>
+
 namespace arbys::bignum::tests {
 
 class BigIntMulTest : public ::testing::Test {
@@ -344,4 +349,145 @@ TEST_F(BigIntMulTest, LargePowerOfTwo) {
     EXPECT_BI_EQ(result, "1048576");
 }
 
+TEST_F(BigIntMulTest, KaratsubaMatchesSchoolbook) {
+    // balanced and unbalanced shapes around and well above the Karatsuba threshold
+    const std::pair<size_t, size_t> shapes[] = {
+      {32, 32}, {33, 32}, {63, 64}, {100, 100}, {257, 255}, {500, 70}, {1000, 999}, {1024, 40}, {777, 400},
+    };
+
+    std::uint64_t seed = 1;
+    for (const auto &[lhs_len, rhs_len] : shapes) {
+        const big_int a = helpers::random_big_int(lhs_len, seed++);
+        const big_int b = helpers::random_big_int(rhs_len, seed++);
+
+        EXPECT_BI_EQ(a * b, detail::simple_multiply(a, b));
+        EXPECT_BI_EQ(b * a, detail::simple_multiply(a, b));
+    }
+}
+
+TEST_F(BigIntMulTest, KaratsubaAllOnesLimbs) {
+    // (2^(64k) - 1)^2 has all-ones limbs at either limb width and drives every carry and borrow path
+    const big_int two_pow_64 = big_int(std::numeric_limits<unsigned long long>::max()) + big_int(1);
+
+    for (const int words : {40, 65, 150}) {
+        big_int a = 1;
+        for (int i = 0; i < words; ++i) {
+            a = a * two_pow_64;
+        }
+        a = a - big_int(1);
+
+        EXPECT_BI_EQ(a * a, detail::simple_multiply(a, a));
+    }
+}
+
+TEST_F(BigIntMulTest, ToomMatchesSchoolbook) {
+    // shapes on both sides of the Toom-3 and Toom-4 crossovers, including parts that come out short
+    const std::pair<size_t, size_t> shapes[] = {
+      {640, 640}, {641, 639}, {900, 700}, {1000, 999}, {1600, 1600}, {1601, 1201}, {1700, 1699}, {2500, 1900},
+    };
+
+    std::uint64_t seed = 100;
+    for (const auto &[lhs_len, rhs_len] : shapes) {
+        const big_int a = helpers::random_big_int(lhs_len, seed++);
+        const big_int b = helpers::random_big_int(rhs_len, seed++);
+
+        EXPECT_BI_EQ(a * b, detail::simple_multiply(a, b));
+        EXPECT_BI_EQ(b * a, detail::simple_multiply(a, b));
+    }
+}
+
+TEST_F(BigIntMulTest, ToomSquareMatchesSchoolbook) {
+    std::uint64_t seed = 200;
+    for (const size_t len : {700, 701, 702, 1000, 1700, 1701, 1703, 2000}) {
+        const big_int a = helpers::random_big_int(len, seed++);
+
+        EXPECT_BI_EQ(a * a, detail::simple_multiply(a, a));
+    }
+}
+
+TEST_F(BigIntMulTest, ToomAllOnesLimbs) {
+    // all-ones parts maximise every evaluation point and push the interpolation to its largest values
+    const big_int two_pow_64 = big_int(std::numeric_limits<unsigned long long>::max()) + big_int(1);
+
+    big_int a = 1;
+    for (int i = 0; i < 1000; ++i) {
+        a = a * two_pow_64;
+    }
+    a = a - big_int(1);
+
+    const big_int b = a - big_int(1);
+    EXPECT_BI_EQ(a * a, detail::simple_multiply(a, a));
+    EXPECT_BI_EQ(a * b, detail::simple_multiply(a, b));
+}
+
+TEST_F(BigIntMulTest, UnbalancedMatchesSchoolbook) {
+    // lopsided shapes left to Karatsuba, and rhs-sized chunks of lhs with a full or short last chunk
+    const std::pair<size_t, size_t> shapes[] = {
+      {10000, 40}, {4000, 33}, {5000, 100}, {2100, 700}, {7100, 700}, {2800, 1400}, {3000, 1999}, {9000, 4000},
+    };
+
+    std::uint64_t seed = 600;
+    for (const auto &[lhs_len, rhs_len] : shapes) {
+        const big_int a = helpers::random_big_int(lhs_len, seed++);
+        const big_int b = helpers::random_big_int(rhs_len, seed++);
+
+        EXPECT_BI_EQ(a * b, detail::simple_multiply(a, b));
+        EXPECT_BI_EQ(b * a, detail::simple_multiply(a, b));
+    }
+}
+
+// Runs the NTT directly, independent of where mul_limbs puts its threshold
+static big_int ntt_multiply(const big_int &lhs, const big_int &rhs) {
+    const auto lhs_limbs = detail::big_int_access::limb_span(lhs);
+    const auto rhs_limbs = detail::big_int_access::limb_span(rhs);
+
+    detail::limb_vector result_limbs(lhs_limbs.size() + rhs_limbs.size());
+    if (&lhs == &rhs) {
+        detail::ntt_sqr(result_limbs, lhs_limbs);
+    } else {
+        detail::ntt_mul(result_limbs, lhs_limbs, rhs_limbs);
+    }
+    return detail::big_int_access::create(false, std::move(result_limbs));
+}
+
+TEST_F(BigIntMulTest, NttMatchesSchoolbook) {
+    const std::pair<size_t, size_t> shapes[] = {
+      {1, 1}, {2, 1}, {3, 3}, {17, 5}, {64, 64}, {100, 99}, {257, 1}, {1000, 333}, {2049, 2047},
+    };
+
+    std::uint64_t seed = 300;
+    for (const auto &[lhs_len, rhs_len] : shapes) {
+        const big_int a = helpers::random_big_int(lhs_len, seed++);
+        const big_int b = helpers::random_big_int(rhs_len, seed++);
+
+        EXPECT_BI_EQ(ntt_multiply(a, b), detail::simple_multiply(a, b));
+        EXPECT_BI_EQ(ntt_multiply(b, a), detail::simple_multiply(a, b));
+        EXPECT_BI_EQ(ntt_multiply(a, a), detail::simple_multiply(a, a));
+    }
+}
+
+TEST_F(BigIntMulTest, NttAllOnesLimbs) {
+    // every coefficient at its maximum gives the largest convolution sums the CRT has to recover
+    const big_int two_pow_64 = big_int(std::numeric_limits<unsigned long long>::max()) + big_int(1);
+
+    big_int a = 1;
+    for (int i = 0; i < 1500; ++i) {
+        a = a * two_pow_64;
+    }
+    a = a - big_int(1);
+
+    const big_int b = a - big_int(1);
+    EXPECT_BI_EQ(ntt_multiply(a, a), detail::simple_multiply(a, a));
+    EXPECT_BI_EQ(ntt_multiply(a, b), detail::simple_multiply(a, b));
+}
+
+TEST_F(BigIntMulTest, NttTierMatchesSchoolbook) {
+    // large enough for mul_limbs to pick the NTT at 32-bit limbs
+    const big_int a = helpers::random_big_int(4500, 400);
+    const big_int b = helpers::random_big_int(4100, 401);
+
+    EXPECT_BI_EQ(a * b, detail::simple_multiply(a, b));
+    EXPECT_BI_EQ(a * a, detail::simple_multiply(a, a));
+}
+
 } // namespace arbys::bignumbers::tests
@@ -0,0 +1,117 @@
+#include "arbys/bignum/big_int.h"
+
+#include "../helpers/helpers.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace arbys::bignum::tests {
+
+class BigIntRadixTest : public ::testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+
+    // One multiply-add per digit; slow but independent of the parsers under test
+    static big_int horner(const std::string_view digits, const int base) {
+        big_int value;
+        for (const char c : digits) {
+            const int digit = c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10;
+            value           = value * base + digit;
+        }
+        return value;
+    }
+};
+
+TEST_F(BigIntRadixTest, KnownValues) {
+    EXPECT_BI_EQ(big_int::from_string("ff", 16).value(), 255);
+    EXPECT_BI_EQ(big_int::from_string("-FF", 16).value(), -255);
+    EXPECT_BI_EQ(big_int::from_string("  +000Ff  ", 16).value(), 255);
+    EXPECT_BI_EQ(big_int::from_string("101", 2).value(), 5);
+    EXPECT_BI_EQ(big_int::from_string("777", 8).value(), 511);
+    EXPECT_BI_EQ(big_int::from_string("zz", 36).value(), 1295);
+    EXPECT_BI_EQ(big_int::from_string("12345678901234567890", 10).value(), "12345678901234567890");
+    EXPECT_BI_EQ(big_int::from_string("ffffffffffffffffffffffffffffffff", 16).value(), "340282366920938463463374607431768211455");
+
+    EXPECT_EQ(big_int(255).to_string(16), "ff");
+    EXPECT_EQ(big_int(-255).to_string(2), "-11111111");
+    EXPECT_EQ(big_int(1295).to_string(36), "zz");
+    EXPECT_EQ(big_int().to_string(16), "0");
+    EXPECT_EQ(big_int().to_string(7), "0");
+    EXPECT_EQ(big_int::from_string("340282366920938463463374607431768211456").value().to_string(16), "1" + std::string(32, '0'));
+}
+
+TEST_F(BigIntRadixTest, ZeroIsNeverNegative) {
+    const auto zero = big_int::from_string("-0000", 16);
+    helpers::expect_ok(zero);
+    EXPECT_FALSE(zero->is_negative());
+    EXPECT_EQ(zero->to_string(16), "0");
+}
+
+TEST_F(BigIntRadixTest, RejectsInvalidInput) {
+    for (const int base : {-16, 0, 1, 37}) {
+        helpers::expect_err(big_int::from_string("1", base), errors::ParseError::InvalidBase);
+        EXPECT_THROW((void)big_int(1).to_string(base), std::invalid_argument);
+    }
+    helpers::expect_err(big_int::from_string("12g4", 16), errors::ParseError::InvalidCharacter);
+    helpers::expect_err(big_int::from_string("1012", 2), errors::ParseError::InvalidCharacter);
+    helpers::expect_err(big_int::from_string("0x1f", 16), errors::ParseError::InvalidCharacter);
+    helpers::expect_err(big_int::from_string("12a", 10), errors::ParseError::InvalidCharacter);
+    helpers::expect_err(big_int::from_string("1_2", 36), errors::ParseError::InvalidCharacter);
+    helpers::expect_err(big_int::from_string("   ", 16), errors::ParseError::EmptyInput);
+    helpers::expect_err(big_int::from_string("-", 16), errors::ParseError::NoDigits);
+
+    // past the divide-and-conquer threshold the bad digit sits in a leaf far from the front
+    std::string long_input(5000, '2');
+    long_input[4321] = '3';
+    helpers::expect_err(big_int::from_string(long_input, 3), errors::ParseError::InvalidCharacter);
+}
+
+TEST_F(BigIntRadixTest, MatchesHornerInEveryBase) {
+    std::uint64_t seed = 1400;
+    for (int base = 2; base <= 36; ++base) {
+        for (const size_t limbs : {1, 2, 5, 30}) {
+            const big_int     a = helpers::random_big_int(limbs, seed++);
+            const std::string s = a.to_string(base);
+
+            EXPECT_NE(s.front(), '0') << "base " << base;
+            EXPECT_BI_EQ(horner(s, base), a) << "base " << base;
+            EXPECT_BI_EQ(big_int::from_string(s, base).value(), a) << "base " << base;
+            EXPECT_EQ((-a).to_string(base), "-" + s) << "base " << base;
+        }
+    }
+}
+
+TEST_F(BigIntRadixTest, LongValuesRoundTrip) {
+    // both sides of the divide-and-conquer thresholds, and digit runs straddling limb boundaries for 8 and 32
+    std::uint64_t seed = 1500;
+    for (const int base : {2, 3, 7, 8, 16, 32, 36}) {
+        for (const size_t limbs : {19, 20, 64, 200, 1500}) {
+            const big_int     a = helpers::random_big_int(limbs, seed++);
+            const std::string s = a.to_string(base);
+
+            EXPECT_BI_EQ(big_int::from_string(s, base).value(), a) << "base " << base << ", " << limbs << " limbs";
+            if (limbs <= 64) {
+                EXPECT_BI_EQ(horner(s, base), a) << "base " << base << ", " << limbs << " limbs";
+            }
+        }
+    }
+}
+
+TEST_F(BigIntRadixTest, PowersOfTheBase) {
+    for (const int base : {3, 10, 16, 36}) {
+        for (const size_t k : {1, 20, 41, 1199, 1200, 1201, 3000}) {
+            const std::string power = "1" + std::string(k, '0');
+            const big_int     value = big_int::from_string(power, base).value();
+
+            EXPECT_EQ(value.to_string(base), power) << base << "^" << k;
+            EXPECT_EQ((value - 1).to_string(base), std::string(k, "0123456789abcdefghijklmnopqrstuvwxyz"[base - 1]))
+              << base << "^" << k << " - 1";
+        }
+    }
+}
+
+} // namespace arbys::bignum::tests
@@ -0,0 +1,153 @@
+#include "arbys/bignum/big_int.h"
+
+#include "../helpers/helpers.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+namespace arbys::bignum::tests {
+
+class BigIntSmallOpsTest : public ::testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(BigIntSmallOpsTest, AddSmall) {
+    const big_int a = big_int::from_string("18446744073709551615").value();
+    EXPECT_BI_EQ(a.add_small(1), "18446744073709551616");
+    EXPECT_BI_EQ(a.add_small(0), a);
+    EXPECT_BI_EQ(a.add_small(-5), "18446744073709551610");
+    EXPECT_BI_EQ(big_int().add_small(-7), "-7");
+    EXPECT_BI_EQ(big_int(3).add_small(-10), "-7");
+    EXPECT_BI_EQ(big_int(-3).add_small(3), "0");
+    EXPECT_FALSE(big_int(-3).add_small(3).is_negative());
+}
+
+TEST_F(BigIntSmallOpsTest, SubSmall) {
+    const big_int a = big_int::from_string("-18446744073709551615").value();
+    EXPECT_BI_EQ(a.sub_small(1u), "-18446744073709551616");
+    EXPECT_BI_EQ(a.sub_small(-1), "-18446744073709551614");
+    EXPECT_BI_EQ(big_int(5).sub_small(5), "0");
+    EXPECT_BI_EQ(big_int().sub_small(std::numeric_limits<std::int64_t>::min()), "9223372036854775808");
+}
+
+TEST_F(BigIntSmallOpsTest, ExtremeOperands) {
+    constexpr auto i64_min = std::numeric_limits<std::int64_t>::min();
+    constexpr auto u64_max = std::numeric_limits<std::uint64_t>::max();
+
+    EXPECT_BI_EQ(big_int(1).add_small(u64_max), "18446744073709551616");
+    EXPECT_BI_EQ(big_int(1).add_small(i64_min), "-9223372036854775807");
+    EXPECT_BI_EQ(big_int(2).mul_small(i64_min), "-18446744073709551616");
+    EXPECT_BI_EQ(big_int(u64_max).mul_small(u64_max), "340282366920938463426481119284349108225");
+}
+
+TEST_F(BigIntSmallOpsTest, MulSmall) {
+    const big_int a = big_int::from_string("-123456789012345678901234567890").value();
+    EXPECT_BI_EQ(a.mul_small(0), "0");
+    EXPECT_FALSE(a.mul_small(0).is_negative());
+    EXPECT_BI_EQ(a.mul_small(-1), "123456789012345678901234567890");
+    EXPECT_BI_EQ(a.mul_small(1000000007), "-123456789876543201987654320198641975230");
+    EXPECT_BI_EQ(big_int().mul_small(-3), "0");
+}
+
+TEST_F(BigIntSmallOpsTest, DivmodSmall) {
+    const auto result = big_int(-7).divmod_small(2);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_BI_EQ(result->first, "-3");
+    EXPECT_BI_EQ(result->second, "-1");
+
+    const big_int a = big_int::from_string("999999999999999999999999999999999999").value();
+    EXPECT_BI_EQ(a.div_small(-1234567).value(), "-810000591300431649315104000025");
+    EXPECT_BI_EQ(a.mod_small(1234567).value(), a % big_int(1234567));
+
+    const auto wide = a.divmod_small(std::numeric_limits<std::uint64_t>::max());
+    ASSERT_TRUE(wide.has_value());
+    EXPECT_BI_EQ(wide->first, "54210108624275221");
+    EXPECT_BI_EQ(wide->second, "12973804955734968084");
+    EXPECT_BI_EQ((-a).mod_small(std::numeric_limits<std::uint64_t>::max()).value(), "-12973804955734968084");
+    EXPECT_BI_EQ((-a).mod_small(-1234567).value(), -(a % big_int(1234567)));
+}
+
+TEST_F(BigIntSmallOpsTest, DivisionByZero) {
+    const big_int a(42);
+    helpers::expect_err(a.divmod_small(0), errors::ArithmeticError::DivisionByZero);
+    helpers::expect_err(a.div_small(0u), errors::ArithmeticError::DivisionByZero);
+    helpers::expect_err(a.mod_small(0LL), errors::ArithmeticError::DivisionByZero);
+    EXPECT_THROW(a / 0, std::domain_error);
+    EXPECT_THROW(a % 0, std::domain_error);
+}
+
+TEST_F(BigIntSmallOpsTest, MixedOperators) {
+    const big_int a = big_int::from_string("100000000000000000000").value();
+    EXPECT_BI_EQ(a + 1, "100000000000000000001");
+    EXPECT_BI_EQ(a - 1, "99999999999999999999");
+    EXPECT_BI_EQ(a * -2, "-200000000000000000000");
+    EXPECT_BI_EQ(a / 7, "14285714285714285714");
+    EXPECT_BI_EQ(a % 7, "2");
+
+    EXPECT_BI_EQ(1 + a, "100000000000000000001");
+    EXPECT_BI_EQ(1 - a, "-99999999999999999999");
+    EXPECT_BI_EQ(3u * a, "300000000000000000000");
+}
+
+TEST_F(BigIntSmallOpsTest, MixedOperatorsOnTemporaries) {
+    const big_int a = big_int::from_string("100000000000000000000").value();
+    EXPECT_BI_EQ(a * a + 1, "10000000000000000000000000000000000000001");
+    EXPECT_BI_EQ((a + a) - 1, "199999999999999999999");
+    EXPECT_BI_EQ((a - a) - 1, "-1");
+    EXPECT_BI_EQ((a + a) * -3, "-600000000000000000000");
+    EXPECT_BI_EQ(1 + (a + a), "200000000000000000001");
+    EXPECT_BI_EQ(1 - (a + a), "-199999999999999999999");
+    EXPECT_BI_EQ(1 - (a - a), "1");
+    EXPECT_BI_EQ(-(a + a), "-200000000000000000000");
+    EXPECT_BI_EQ(-(a - a), "0");
+}
+
+TEST_F(BigIntSmallOpsTest, MatchesBigIntOperations) {
+    const std::int64_t values[] = {
+      1, -1, 2, 7, -1000000007, 4294967295, 4294967296, -9223372036854775807, std::numeric_limits<std::int64_t>::min(),
+    };
+
+    std::uint64_t seed = 800;
+    for (const size_t len : {1, 2, 3, 10, 40}) {
+        big_int a = helpers::random_big_int(len, seed++);
+        for (int sign = 0; sign < 2; ++sign, a = -a) {
+            for (const std::int64_t v : values) {
+                const big_int b(v);
+                EXPECT_BI_EQ(a.add_small(v), a + b);
+                EXPECT_BI_EQ(a.sub_small(v), a - b);
+                EXPECT_BI_EQ(a.mul_small(v), a * b);
+
+                const auto small = a.divmod_small(v);
+                const auto big   = a.div_mod(b);
+                ASSERT_TRUE(small.has_value() && big.has_value());
+                EXPECT_BI_EQ(small->first, big->first);
+                EXPECT_BI_EQ(small->second, big->second);
+            }
+        }
+    }
+}
+
+TEST_F(BigIntSmallOpsTest, CompoundAssign) {
+    big_int a = std::numeric_limits<std::uint64_t>::max();
+    a += 1;
+    EXPECT_BI_EQ(a, "18446744073709551616");
+    a -= 2u;
+    EXPECT_BI_EQ(a, "18446744073709551614");
+    a *= -3;
+    EXPECT_BI_EQ(a, "-55340232221128654842");
+    a /= 7;
+    EXPECT_BI_EQ(a, "-7905747460161236406");
+    a %= 1000;
+    EXPECT_BI_EQ(a, "-406");
+    a *= 0;
+    EXPECT_BI_EQ(a, "0");
+    EXPECT_FALSE(a.is_negative());
+    EXPECT_THROW(a /= 0, std::domain_error);
+}
+
+} // namespace arbys::bignum::tests
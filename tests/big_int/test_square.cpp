@@ -0,0 +1,78 @@
+#include "arbys/bignum/big_int.h"
+
+#include "../../src/arbys/bignum/detail/big_int_internal.h"
+#include "../../src/arbys/bignum/detail/detail.h"
+#include "../helpers/helpers.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace arbys::bignum::tests {
+
+class BigIntSquareTest : public ::testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(BigIntSquareTest, Zero) {
+    const big_int a;
+    EXPECT_BI_EQ(a.square(), "0");
+    EXPECT_FALSE(a.square().is_negative());
+}
+
+TEST_F(BigIntSquareTest, One) {
+    EXPECT_BI_EQ(big_int(1).square(), "1");
+    EXPECT_BI_EQ(big_int(-1).square(), "1");
+}
+
+TEST_F(BigIntSquareTest, SmallNumbers) {
+    EXPECT_BI_EQ(big_int(12345).square(), "152399025");
+    EXPECT_BI_EQ(big_int(99999).square(), "9999800001");
+}
+
+TEST_F(BigIntSquareTest, NegativeIsPositive) {
+    const big_int a = big_int::from_string("-123456789012345678901234567890").value();
+    EXPECT_BI_EQ(a.square(), "15241578753238836750495351562536198787501905199875019052100");
+    EXPECT_FALSE(a.square().is_negative());
+}
+
+TEST_F(BigIntSquareTest, MulWithItselfSquares) {
+    const big_int a = big_int::from_string("-98765432109876543210").value();
+    EXPECT_BI_EQ(a * a, a.square());
+    EXPECT_BI_EQ(a.mul(a), "9754610579850632525677488187778997104100");
+}
+
+TEST_F(BigIntSquareTest, MatchesSchoolbookAcrossTiers) {
+    // sizes on both sides of the basecase, Karatsuba, Toom and NTT crossovers
+    std::uint64_t seed = 500;
+    for (const size_t len : {1, 2, 3, 47, 48, 49, 97, 200, 701, 1701, 2600, 4200}) {
+        const big_int a = helpers::random_big_int(len, seed++);
+        const big_int b = a;
+
+        EXPECT_BI_EQ(a.square(), detail::simple_multiply(a, b));
+    }
+}
+
+TEST_F(BigIntSquareTest, KernelsAllOnesLimbs) {
+    // all-ones limbs carry through every position of the doubling pass
+    for (const size_t len : {1, 2, 5, 48, 130}) {
+        const std::vector<detail::limb_t> x(len, std::numeric_limits<detail::limb_t>::max());
+        std::vector<detail::limb_t>       expected(2 * len);
+        std::vector<detail::limb_t>       actual(2 * len);
+
+        detail::mul_basecase(expected, x, std::vector<detail::limb_t>(x));
+
+        detail::sqr_basecase(actual, x);
+        EXPECT_EQ(actual, expected) << "sqr_basecase, " << len << " limbs";
+
+        std::vector<detail::limb_t> scratch(detail::karatsuba_sqr_scratch_size(len));
+        detail::karatsuba_sqr(actual, x, scratch);
+        EXPECT_EQ(actual, expected) << "karatsuba_sqr, " << len << " limbs";
+    }
+}
+
+} // namespace arbys::bignum::tests
@@ -0,0 +1,151 @@
+#include "arbys/bignum/big_int.h"
+
+#include "../../src/arbys/bignum/detail/big_int_internal.h"
+#include "../helpers/helpers.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace arbys::bignum::tests {
+
+// 2^128 + 1 needs five 32-bit limbs, one more than fits inline
+const std::string large_value = "340282366920938463463374607431768211457";
+
+TEST(BigIntStorageTest, DefaultIsZero) {
+    const big_int a;
+    EXPECT_TRUE(a.is_zero());
+    EXPECT_FALSE(a.is_negative());
+    EXPECT_BI_EQ(a, "0");
+}
+
+TEST(BigIntStorageTest, CopySmall) {
+    const big_int a = -123456789;
+    const big_int b = a;
+    EXPECT_BI_EQ(b, a);
+    EXPECT_BI_EQ(b, "-123456789");
+}
+
+TEST(BigIntStorageTest, CopyLarge) {
+    const big_int a = big_int::from_string(large_value).value();
+    const big_int b = a;
+    EXPECT_BI_EQ(b, a);
+    EXPECT_BI_EQ(b, large_value);
+}
+
+TEST(BigIntStorageTest, MovedFromIsZero) {
+    big_int       a = big_int::from_string(large_value).value();
+    const big_int b = std::move(a);
+    EXPECT_BI_EQ(b, large_value);
+    EXPECT_TRUE(a.is_zero());
+    EXPECT_BI_EQ(a + b, large_value);
+}
+
+TEST(BigIntStorageTest, AssignAcrossInlineBoundary) {
+    big_int       a     = 42;
+    const big_int large = big_int::from_string(large_value).value();
+
+    a = large;
+    EXPECT_BI_EQ(a, large_value);
+
+    a = big_int(7);
+    EXPECT_BI_EQ(a, "7");
+
+    a = large;
+    a = a - large;
+    EXPECT_BI_EQ(a, "0");
+}
+
+TEST(BigIntStorageTest, SelfAssignment) {
+    big_int        a   = big_int::from_string(large_value).value();
+    const big_int &ref = a;
+    a                  = ref;
+    EXPECT_BI_EQ(a, large_value);
+
+    big_int &self = a;
+    a             = std::move(self);
+    EXPECT_BI_EQ(a, large_value);
+}
+
+TEST(BigIntStorageTest, GrowsPastInlineCapacity) {
+    big_int       a   = 1;
+    const big_int two = 2;
+    for (int i = 0; i < 200; ++i) {
+        a = a * two;
+    }
+    EXPECT_BI_EQ(a, "1606938044258990275541962092341162602522202993782792835301376");
+}
+
+TEST(BigIntStorageTest, InPlaceOperatorsReuseBuffer) {
+    // long enough to live on the heap with 64-bit limbs too
+    const std::string value = large_value + large_value;
+
+    big_int       a    = big_int::from_string(value).value();
+    const auto   *data = detail::big_int_access::limbs(a).data();
+    const big_int one  = 1;
+
+    a += one;
+    a -= big_int(value.size());
+    a += 12345;
+    a *= 3;
+    EXPECT_EQ(detail::big_int_access::limbs(a).data(), data);
+
+    const big_int sum = std::move(a) + one;
+    EXPECT_EQ(detail::big_int_access::limbs(sum).data(), data);
+
+    big_int       b          = big_int::from_string(value).value();
+    const auto   *b_data     = detail::big_int_access::limbs(b).data();
+    const big_int difference = one - std::move(b);
+    EXPECT_EQ(detail::big_int_access::limbs(difference).data(), b_data);
+    EXPECT_BI_EQ(difference, "-" + value.substr(0, value.size() - 1) + "6");
+
+
+    // a native integer minus a temporary negates the temporary and adds in place
+    big_int       c                 = big_int::from_string(value).value();
+    const auto   *c_data            = detail::big_int_access::limbs(c).data();
+    const big_int scalar_difference = 1 - std::move(c);
+    EXPECT_EQ(detail::big_int_access::limbs(scalar_difference).data(), c_data);
+    EXPECT_BI_EQ(scalar_difference, difference);
+}
+
+TEST(BigIntStorageTest, FromLimbsAdoptsTheBuffer) {
+    std::vector<limb_type> limbs(40, 7);
+    limbs.push_back(0); // zero limbs on top are dropped
+    const limb_type *data = limbs.data();
+
+    const big_int a = big_int::from_limbs(std::move(limbs), true);
+    EXPECT_EQ(a.limbs().data(), data);
+    EXPECT_EQ(a.limbs().size(), 40u);
+    EXPECT_TRUE(a.is_negative());
+
+    EXPECT_BI_EQ(big_int::from_limbs({}), "0");
+    EXPECT_BI_EQ(big_int::from_limbs({0, 0}, true), "0");
+    EXPECT_FALSE(big_int::from_limbs({0, 0}, true).is_negative());
+    EXPECT_BI_EQ(big_int::from_limbs({5}, true), "-5");
+}
+
+TEST(BigIntStorageTest, ReleaseLimbsRoundTrips) {
+    big_int          a    = big_int::from_string(large_value + large_value).value();
+    const big_int    copy = a;
+    const limb_type *data = a.limbs().data();
+
+    std::vector<limb_type> limbs = a.release_limbs();
+    EXPECT_EQ(limbs.data(), data);
+    EXPECT_TRUE(std::ranges::equal(limbs, copy.limbs()));
+    EXPECT_TRUE(a.is_zero());
+    EXPECT_BI_EQ(a + 1, "1");
+
+    const big_int back = big_int::from_limbs(std::move(limbs));
+    EXPECT_EQ(back.limbs().data(), data);
+    EXPECT_BI_EQ(back, copy);
+
+    // inline values come out as a copy
+    big_int small = -42;
+    EXPECT_EQ(small.release_limbs(), std::vector<limb_type>{42});
+    EXPECT_TRUE(small.is_zero());
+    EXPECT_EQ(big_int().release_limbs(), std::vector<limb_type>{0});
+}
+
+} // namespace arbys::bignum::tests
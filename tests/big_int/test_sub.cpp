@@ -46,4 +46,42 @@ TEST(BigIntSubTest, MultipleSubs) {
     EXPECT_BI_EQ(res, "32381349447599944468278093");
 }
 
+TEST(BigIntSubTest, BorrowAcrossLimbBoundaries) {
+    const big_int a = big_int::from_string("340282366920938463463374607431768211456").value();
+    const big_int b = 1;
+    EXPECT_BI_EQ(a - b, "340282366920938463463374607431768211455");
+    EXPECT_BI_EQ(b - a, "-340282366920938463463374607431768211455");
+}
+
+TEST(BigIntSubTest, CompoundAssign) {
+    big_int a = 5;
+    a -= big_int(7);
+    EXPECT_BI_EQ(a, "-2");
+
+    a -= big_int::from_string("-340282366920938463463374607431768211456").value();
+    EXPECT_BI_EQ(a, "340282366920938463463374607431768211454");
+
+    a -= a;
+    EXPECT_BI_EQ(a, "0");
+    EXPECT_FALSE(a.is_negative());
+}
+
+TEST(BigIntSubTest, SubZero) {
+    const big_int a = -42;
+    EXPECT_BI_EQ(a - big_int(0), "-42");
+    EXPECT_BI_EQ(big_int(0) - a, "42");
+    EXPECT_FALSE((big_int(0) - big_int(0)).is_negative());
+}
+
+TEST(BigIntSubTest, RvalueOperands) {
+    const big_int a = big_int::from_string("100000000000000000000000000000").value();
+    const big_int b = big_int::from_string("1").value();
+
+    EXPECT_BI_EQ(big_int(a) - b, "99999999999999999999999999999");
+    EXPECT_BI_EQ(b - big_int(a), "-99999999999999999999999999999");
+    EXPECT_BI_EQ(big_int(a) - big_int(a), "0");
+    EXPECT_FALSE((a - big_int(a)).is_negative());
+    EXPECT_BI_EQ(a - b - b - b, "99999999999999999999999999997");
+}
+
 } // namespace arbys::bignumbers::tests::sub
@@ -0,0 +1,61 @@
+#include "arbys/bignum/big_int.h"
+
+#include "../helpers/helpers.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace arbys::bignum::tests {
+
+class BigIntToStringTest : public ::testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(BigIntToStringTest, Small) {
+    EXPECT_EQ(big_int().to_string(), "0");
+    EXPECT_EQ(big_int(7).to_string(), "7");
+    EXPECT_EQ(big_int(-1000000000).to_string(), "-1000000000");
+    EXPECT_EQ(big_int(999999999).to_string(), "999999999");
+    EXPECT_EQ(big_int(18446744073709551615ULL).to_string(), "18446744073709551615");
+}
+
+TEST_F(BigIntToStringTest, PowersOfTenAcrossSplits) {
+    // 10^k and 10^k - 1 at lengths on both sides of the divide-and-conquer threshold and its levels
+    for (const size_t k : {9, 19, 38, 100, 300, 577, 1000, 2500, 6000}) {
+        const std::string power = "1" + std::string(k, '0');
+        const std::string nines(k, '9');
+
+        EXPECT_EQ(big_int::from_string(power).value().to_string(), power) << "10^" << k;
+        EXPECT_EQ(big_int::from_string(nines).value().to_string(), nines) << "10^" << k << " - 1";
+    }
+}
+
+TEST_F(BigIntToStringTest, InnerZerosArePadded) {
+    // lower halves with many leading zeros must keep them
+    for (const size_t k : {500, 1200, 4000}) {
+        const std::string s = "-7" + std::string(k, '0') + "3" + std::string(k / 3, '0') + "1";
+        EXPECT_EQ(big_int::from_string(s).value().to_string(), s);
+    }
+}
+
+TEST_F(BigIntToStringTest, RoundTripsRandomValues) {
+    std::uint64_t seed = 1100;
+    for (const size_t len : {1, 2, 29, 30, 31, 64, 200, 700, 2000}) {
+        const big_int     a = helpers::random_big_int(len, seed++);
+        const std::string s = a.to_string();
+
+        EXPECT_NE(s.front(), '0');
+        EXPECT_BI_EQ(big_int::from_string(s).value(), a);
+        EXPECT_EQ((-a).to_string(), "-" + s);
+    }
+}
+
+TEST_F(BigIntToStringTest, RepeatedCallsReuseCachedPowers) {
+    const big_int a = helpers::random_big_int(3000, 1200);
+    EXPECT_EQ(a.to_string(), a.to_string());
+}
+
+} // namespace arbys::bignum::tests
@@ -0,0 +1,140 @@
+#include "arbys/bignum/big_int.h"
+#include "arbys/bignum/big_int_view.h"
+
+#include "../helpers/helpers.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <charconv>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace arbys::bignum::tests {
+
+class BigIntViewTest : public ::testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(BigIntViewTest, ViewsExternalLimbs) {
+    // 2^LIMB_BITS + 5, with zero limbs on top as a fixed-width table row would have them
+    const std::array<limb_type, 4> limbs{5, 1, 0, 0};
+    const big_int_view             view(true, limbs);
+
+    EXPECT_EQ(view.limbs().size(), 2u);
+    EXPECT_EQ(view.limbs().data(), limbs.data());
+    EXPECT_TRUE(view.is_negative());
+    EXPECT_BI_EQ(big_int(view), -(big_int(1) + big_int(~limb_type{0})) - 5);
+}
+
+TEST_F(BigIntViewTest, ZeroHasOneLimbAndNoSign) {
+    const std::array<limb_type, 3> zeros{};
+    for (const big_int_view view : {big_int_view(), big_int_view(true, zeros), big_int_view(true, {})}) {
+        EXPECT_TRUE(view.is_zero());
+        EXPECT_FALSE(view.is_negative());
+        EXPECT_EQ(view.limbs().size(), 1u);
+        EXPECT_EQ(view.to_string(), "0");
+        EXPECT_EQ(view, big_int());
+    }
+}
+
+TEST_F(BigIntViewTest, BigIntConvertsWithoutCopying) {
+    const big_int      a = helpers::random_big_int(40, 41);
+    const big_int_view view(a);
+    EXPECT_EQ(view, a);
+    EXPECT_EQ(view.limbs().size(), 40u);
+    EXPECT_EQ(big_int_view(-a).limbs().size(), 40u);
+    EXPECT_TRUE(big_int_view(-a).is_negative());
+}
+
+TEST_F(BigIntViewTest, Comparison) {
+    const big_int a = helpers::random_big_int(5, 42);
+    const big_int b = a + 1;
+    const auto    limbs = std::vector<limb_type>(big_int_view(a).limbs().begin(), big_int_view(a).limbs().end());
+
+    const big_int_view view(false, limbs);
+    EXPECT_EQ(view, a);
+    EXPECT_NE(view, -a);
+    EXPECT_LT(view, b);
+    EXPECT_GT(view, -b);
+    EXPECT_GT(b, view);
+    EXPECT_LT(big_int_view(true, limbs), big_int_view(false, limbs));
+    EXPECT_EQ(view <=> a, std::strong_ordering::equal);
+}
+
+TEST_F(BigIntViewTest, ArithmeticMatchesBigInt) {
+    std::uint64_t seed = 43;
+    for (const size_t size : {1, 2, 7, 40, 150}) {
+        const big_int a = helpers::random_big_int(size, seed++);
+        const big_int b = -helpers::random_big_int(size / 2 + 1, seed++);
+
+        const std::vector<limb_type> a_limbs(big_int_view(a).limbs().begin(), big_int_view(a).limbs().end());
+        const big_int_view           view(a.is_negative(), a_limbs);
+
+        EXPECT_BI_EQ(view + b, a + b);
+        EXPECT_BI_EQ(view - b, a - b);
+        EXPECT_BI_EQ(view * b, a * b);
+        EXPECT_BI_EQ(view / b, a / b);
+        EXPECT_BI_EQ(view % b, a % b);
+        EXPECT_BI_EQ(view * view, a.square());
+
+        // shared limbs take the squaring kernels, which must still respect both signs
+        const big_int_view negative(true, a_limbs);
+        EXPECT_BI_EQ(negative * negative, a.square());
+        EXPECT_BI_EQ(negative * negative.abs(), -a.square());
+        EXPECT_BI_EQ(negative.abs() * negative, -a.square());
+        EXPECT_BI_EQ(big_int_view(-a) * big_int_view(-a).abs(), -a.square());
+        EXPECT_BI_EQ(b - view, b - a);
+
+        big_int acc = b;
+        acc += view;
+        EXPECT_BI_EQ(acc, b + a);
+        acc -= view;
+        EXPECT_BI_EQ(acc, b);
+        acc *= view;
+        EXPECT_BI_EQ(acc, b * a);
+        acc /= view;
+        EXPECT_BI_EQ(acc, b);
+    }
+}
+
+TEST_F(BigIntViewTest, DivisionByZeroThrows) {
+    EXPECT_THROW((void)(big_int(5) / big_int_view()), std::domain_error);
+    EXPECT_THROW((void)(big_int(5) % big_int_view()), std::domain_error);
+    EXPECT_BI_EQ(big_int_view() / big_int(7), big_int());
+}
+
+TEST_F(BigIntViewTest, Formatting) {
+    const big_int      a = -helpers::random_big_int(60, 44);
+    const big_int_view view(a);
+
+    EXPECT_EQ(view.to_string(), a.to_string());
+    EXPECT_EQ(view.to_string(16), a.to_string(16));
+    EXPECT_EQ(view.to_string(7), a.to_string(7));
+    EXPECT_EQ(view.max_chars(), a.max_chars());
+
+    std::string buffer(view.max_chars(), '\0');
+    const auto  result = view.to_chars(buffer.data(), buffer.data() + buffer.size());
+    ASSERT_EQ(result.ec, std::errc{});
+    EXPECT_EQ(std::string(buffer.data(), result.ptr), a.to_string());
+}
+
+TEST_F(BigIntViewTest, HashAgreesWithBigInt) {
+    const big_int                a = helpers::random_big_int(9, 45);
+    const std::vector<limb_type> limbs(big_int_view(a).limbs().begin(), big_int_view(a).limbs().end());
+
+    EXPECT_EQ(std::hash<big_int_view>{}(big_int_view(false, limbs)), std::hash<big_int>{}(a));
+    EXPECT_NE(std::hash<big_int>{}(a), std::hash<big_int>{}(-a));
+    EXPECT_EQ(std::hash<big_int>{}(big_int(0)), std::hash<big_int_view>{}(big_int_view(true, {})));
+
+    std::unordered_set<big_int> seen{a, -a, big_int(1)};
+    EXPECT_TRUE(seen.contains(big_int(big_int_view(false, limbs))));
+    EXPECT_FALSE(seen.contains(a + 1));
+}
+
+} // namespace arbys::bignum::tests
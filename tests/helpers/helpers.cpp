@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 
 #include <print>
+#include <random>
 #include <ranges>
 
 #include "../../include/arbys/bignum/big_int.h"
@@ -89,6 +90,18 @@ namespace arbys::bignum::tests::helpers {
         return ::testing::AssertionSuccess();
     }
 
+    big_int random_big_int(const size_t limbs, const std::uint64_t seed) {
+        std::mt19937_64 rng(seed);
+        detail::limb_vector digits(limbs);
+        for (auto &limb : digits) {
+            limb = static_cast<detail::limb_t>(rng());
+        }
+        if (limbs > 0 && digits.back() == 0) {
+            digits.back() = 1;
+        }
+        return detail::big_int_access::create(false, std::move(digits));
+    }
+
     std::string big_int_string_add(const std::string& a, const std::string& b) {
         // Ensure both inputs contain only digits
         for (const char ch : a)
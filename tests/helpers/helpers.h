@@ -32,6 +32,9 @@ namespace arbys::bignum::tests::helpers {
     void expect_eq(const big_int &bn1, const big_int &bn2);
     std::string big_int_string_add(const std::string& a, const std::string& b);
 
+    // Random non-negative big_int with exactly `limbs` limbs (the top limb is non-zero)
+    big_int random_big_int(size_t limbs, std::uint64_t seed);
+
 
     template<typename T, typename E>
     void expect_ok(const std::expected<T, E>& exp) {